@@ -341,5 +341,44 @@ class coreneuron(object):
 
         return arg
 
+    def read_spikes(self, path):
+        """
+        Return (times, gids) lists from a spike file written by
+        ``nrniv-core --binary-spikes`` (out.bin), sorted by time then gid.
+        :param path: Path of the out.bin file
+
+        """
+        import struct
+
+        header = struct.Struct("=8sdQQ")
+
+        def varints(data):
+            x = shift = 0
+            for c in data:
+                x |= (c & 0x7F) << shift
+                shift += 7
+                if not c & 0x80:
+                    yield x
+                    x = shift = 0
+
+        times, gids = [], []
+        with open(path, "rb") as f:
+            data = f.read()
+        pos = 0
+        while pos < len(data):
+            magic, tick, count, nbytes = header.unpack_from(data, pos)
+            if magic != b"CNSPIKE1":
+                raise ValueError(f"{path} is not a CoreNEURON binary spike file")
+            pos += header.size
+            values = varints(data[pos : pos + nbytes])
+            pos += nbytes
+            ticks = 0
+            for i in range(count):
+                dt, gid = next(values), next(values)
+                ticks = (dt >> 1) ^ -(dt & 1) if i == 0 else ticks + dt
+                times.append(ticks * tick)
+                gids.append(gid)
+        return times, gids
+
 
 sys.modules[__name__] = coreneuron()
@@ -1,3 +1,5 @@
+import os
+
 # TODO: This option is not currently observed
 use_reaction_contribution_to_jacobian = True
 
@@ -21,6 +23,27 @@ ics_partial_surface_resolution = 1
 fixed_step_factor = 1
 
 
+def _default_reaction_cache_dir():
+    # NRN_RXD_CACHE_DIR chooses the directory, and set but empty turns the
+    # cache off; otherwise neuron/rxd in the XDG cache directory
+    if "NRN_RXD_CACHE_DIR" in os.environ:
+        return os.environ["NRN_RXD_CACHE_DIR"] or None
+    base = os.environ.get("XDG_CACHE_HOME") or os.path.join(
+        os.path.expanduser("~"), ".cache"
+    )
+    return os.path.join(base, "neuron", "rxd")
+
+
+# directory where the compiled reaction kernels are kept, keyed by a hash of
+# their source, the compiler, librxdmath and the NEURON version, so a model
+# compiles them only once; None disables the cache
+reaction_cache_dir = _default_reaction_cache_dir()
+
+# evaluate the extracellular reactions for a batch of voxels in each call of
+# the compiled kernel; False calls it once per voxel
+ecs_reaction_batch = True
+
+
 class _OverrideLockouts:
     def __init__(self):
         self._extracellular = True
@@ -265,6 +265,10 @@ class Extracellular:
     account for other cells. Note: the section volumes are assumed to be negligible and are ignored by the simulation.
 
     Assumes tortuosity=1.
+
+    solver = "adi" (default) or "multigrid"; how the diffusion of species on this region is solved. The multigrid solver is an implicit backward Euler solve that stays stable for large time steps and also preconditions the variable step method; it is only used when the volume fraction and tortuosity are scalars.
+
+    decompose = False (default) or True; with more than one MPI process, split the grid between them instead of solving all of it on every process. Process r advances the x planes r * nx / nhost <= i < (r + 1) * nx / nhost, where nx is the number of voxels along x; elsewhere the concentrations (e.g. states3d) are only kept up to date for the voxels of the segments on the process. Requires the "adi" solver, scalar volume fraction and tortuosity, and at least one x plane per process.
     """
 
     def __init__(
@@ -279,6 +283,8 @@ class Extracellular:
         volume_fraction=1,
         tortuosity=None,
         permeability=None,
+        solver="adi",
+        decompose=False,
     ):
         from . import options
 
@@ -323,6 +329,21 @@ class Extracellular:
                 permeability, True
             )
 
+        if solver not in ("adi", "multigrid"):
+            raise RxDException(
+                f'Extracellular region solver={solver!r} is invalid, solver should be "adi" or "multigrid"'
+            )
+        self._solver = solver
+        if decompose and (
+            solver != "adi"
+            or not numpy.isscalar(self.alpha)
+            or not numpy.isscalar(self.tortuosity)
+        ):
+            raise RxDException(
+                'Extracellular region decompose=True requires solver="adi" and scalar volume_fraction and tortuosity'
+            )
+        self._decompose = bool(decompose)
+
     def __repr__(self):
         return f"Extracellular(xlo={self._xlo!r}, ylo={self._ylo!r}, zlo={self._zlo!r}, xhi={self._xhi!r}, yhi={self._yhi!r}, zhi={self._zhi!r}, tortuosity={self.tortuosity!r}, volume_fraction={self.alpha!r})"
 
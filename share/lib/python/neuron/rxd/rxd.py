@@ -9,6 +9,7 @@ from . import options
 from .rxdException import RxDException
 from . import initializer
 import collections
+import hashlib
 import os
 import sysconfig
 import uuid
@@ -125,6 +126,7 @@ ecs_register_reaction.argtypes = [
     ctypes.c_int,
     _int_ptr,
     ctypes._CFuncPtr,
+    ctypes._CFuncPtr,
 ]
 
 
@@ -506,10 +508,7 @@ def _find_librxdmath():
     return dll
 
 
-def _cxx_compile(formula):
-    filename = "rxddll" + str(uuid.uuid1())
-    with open(filename + ".cpp", "w") as f:
-        f.write(formula)
+def _cxx_compiler():
     math_library = "-lm"
     fpic = "-fPIC"
     try:
@@ -528,8 +527,14 @@ def _cxx_compile(formula):
                 )
         else:
             gcc = "g++"
+    return gcc, fpic, math_library
+
+
+def _cxx_build(filename):
+    gcc, fpic, math_library = _cxx_compiler()
     # TODO: Check this works on non-Linux machines
-    gcc_cmd = f"{gcc} -I{sysconfig.get_path('include')} "
+    # contraction is disabled so the optimized kernels give the same results
+    gcc_cmd = f"{gcc} -O2 -ffp-contract=off -I{sysconfig.get_path('include')} "
     gcc_cmd += f"-shared {fpic} {filename}.cpp {_find_librxdmath()}"
     gcc_cmd += f" -o {filename}.so {math_library}"
     if sys.platform.lower().startswith("win"):
@@ -542,15 +547,70 @@ def _cxx_compile(formula):
         os.putenv("PATH", my_path)
     else:
         os.system(gcc_cmd)
+
+
+_librxdmath_digest = None
+
+
+def _librxdmath_build():
+    """Returns a digest of librxdmath, so a rebuilt library misses the cache."""
+    global _librxdmath_digest
+    if _librxdmath_digest is None:
+        with open(_find_librxdmath(), "rb") as f:
+            _librxdmath_digest = hashlib.sha256(f.read()).hexdigest()
+    return _librxdmath_digest
+
+
+def _cxx_cached(formula):
+    """Returns the path of the compiled formula in options.reaction_cache_dir,
+    compiling it if this source has not been seen before, or None if there is
+    no usable cache directory."""
+    cache_dir = options.reaction_cache_dir
+    if not cache_dir:
+        return None
+    key = hashlib.sha256(
+        "\n".join(
+            [
+                *_cxx_compiler(),
+                sysconfig.get_path("include"),
+                _find_librxdmath(),
+                _librxdmath_build(),
+                h.nrnversion(),
+                formula,
+            ]
+        ).encode()
+    ).hexdigest()
+    target = os.path.join(cache_dir, f"rxd_{key}.so")
+    if os.path.exists(target):
+        return target
+    try:
+        os.makedirs(cache_dir, exist_ok=True)
+        filename = os.path.join(cache_dir, "rxddll" + str(uuid.uuid1()))
+        with open(filename + ".cpp", "w") as f:
+            f.write(formula)
+    except OSError:
+        return None
+    _cxx_build(filename)
+    os.remove(f"{filename}.cpp")
+    if not os.path.exists(f"{filename}.so"):
+        return None
+    # other ranks may be compiling the same source, the rename is atomic
+    os.replace(f"{filename}.so", target)
+    return target
+
+
+def _cxx_load(formula):
+    """Compiles the C++ source in formula and returns the loaded library."""
     # the rxdmath_dll appears necessary for using librxdmath under certain gcc/OS pairs
     rxdmath_dll = ctypes.cdll[_find_librxdmath()]
+    cached = _cxx_cached(formula)
+    if cached is not None:
+        return ctypes.cdll[cached]
+    filename = "rxddll" + str(uuid.uuid1())
+    with open(filename + ".cpp", "w") as f:
+        f.write(formula)
+    _cxx_build(filename)
     dll = ctypes.cdll[f"{os.path.abspath(filename)}.so"]
-    reaction = dll.reaction
-    reaction.argtypes = [
-        ctypes.POINTER(ctypes.c_double),
-        ctypes.POINTER(ctypes.c_double),
-    ]
-    reaction.restype = ctypes.c_double
     os.remove(f"{filename}.cpp")
     if sys.platform.lower().startswith("win"):
         # cannot remove dll that are in use
@@ -558,6 +618,16 @@ def _cxx_compile(formula):
         _windows_dll_files.append(f"{filename}.so")
     else:
         os.remove(f"{filename}.so")
+    return dll
+
+
+def _cxx_compile(formula):
+    reaction = _cxx_load(formula).reaction
+    reaction.argtypes = [
+        ctypes.POINTER(ctypes.c_double),
+        ctypes.POINTER(ctypes.c_double),
+    ]
+    reaction.restype = ctypes.c_double
     return reaction
 
 
@@ -1116,6 +1186,28 @@ def _get_node_indices(species, region, sec3d, x3d, sec1d, x1d):
     return index_1d, indices3d, vol1d, vols3d
 
 
+def _ecs_reaction_kernels(body, num_species, num_params):
+    """Returns the source for the extracellular reaction with the statements in
+    body, both for one voxel and as a batched kernel that evaluates n voxels
+    stored with a stride of n (species j of voxel c at species[j * n + c])."""
+    return (
+        _c_headers
+        + "void reaction(double* species_3d, double* params_3d, double* rhs)\n{"
+        + body
+        + "\n}\n"
+        + "void reaction_batch(const int n, const double* species, const double* params, double* rhs_batch)\n{"
+        + "\n\tfor (int c = 0; c < n; c++) {"
+        + f"\n\tdouble species_3d[{max(num_species, 1)}];"
+        + f"\n\tdouble params_3d[{max(num_params, 1)}];"
+        + f"\n\tdouble rhs[{max(num_species, 1)}] = {{0}};"
+        + f"\n\tfor (int j = 0; j < {num_species}; j++) species_3d[j] = species[j * n + c];"
+        + f"\n\tfor (int j = 0; j < {num_params}; j++) params_3d[j] = params[j * n + c];"
+        + body
+        + f"\n\tfor (int j = 0; j < {num_species}; j++) rhs_batch[j * n + c] = rhs[j];"
+        + "\n\t}\n}\n}\n"
+    )
+
+
 def _compile_reactions():
     # clear all previous reactions (intracellular & extracellular) and the
     # supporting indexes
@@ -1693,12 +1785,9 @@ def _compile_reactions():
             grid_ids = []
             all_gids = set()
             param_gids = set()
-            fxn_string = _c_headers
             # TODO: find the nrn include path in python
             # It is necessary for a couple of function in python that are not in math.h
-            fxn_string += (
-                "void reaction(double* species_3d, double* params_3d, double* rhs)\n{"
-            )
+            fxn_string = ""
             # declare the "rate" variable if any reactions (non-rates)
             for rptr in [r for rlist in list(ecs_regions_inv.values()) for r in rlist]:
                 if not isinstance(rptr(), rate.Rate):
@@ -1793,13 +1882,20 @@ def _compile_reactions():
                             f"\n\trhs[{pid}] {operator} ({r._mult[idx]})*rate;"
                         )
                         idx += 1
-            fxn_string += "\n}\n}\n"
+            dll = _cxx_load(
+                _ecs_reaction_kernels(fxn_string, len(all_gids), len(param_gids))
+            )
             ecs_register_reaction(
                 0,
                 len(all_gids),
                 len(param_gids),
                 _list_to_cint_array(all_gids + param_gids),
-                _cxx_compile(fxn_string),
+                dll.reaction,
+                (
+                    dll.reaction_batch
+                    if options.ecs_reaction_batch
+                    else ctypes.cast(None, type(dll.reaction_batch))
+                ),
             )
 
 
@@ -137,6 +137,15 @@ _set_tortuosity.argtypes = [ctypes.c_int, ctypes.c_int, ctypes.py_object]
 _set_volume_fraction = nrn_dll_sym("set_volume_fraction")
 _set_volume_fraction.argtypes = [ctypes.c_int, ctypes.c_int, ctypes.py_object]
 
+# function to choose the extracellular diffusion solver
+_set_ecs_solver = nrn_dll_sym("set_ecs_solver")
+_set_ecs_solver.argtypes = [ctypes.c_int, ctypes.c_int, ctypes.c_int]
+
+# function to split an extracellular grid between the MPI processes
+_set_ecs_decomposition = nrn_dll_sym("set_ecs_decomposition")
+_set_ecs_decomposition.argtypes = [ctypes.c_int, ctypes.c_int]
+_set_ecs_decomposition.restype = ctypes.c_int
+
 
 # The difference here is that defined species only exists after rxd initialization
 _all_species = []
@@ -1272,6 +1281,13 @@ class _ExtracellularSpecies(_SpeciesMathable):
                 "Diffusion coefficient %s for %s is invalid. A single value D or a tuple of 3 values (Dx,Dy,Dz) is required for the diffusion coefficient."
                 % (repr(d), name)
             )
+        if region._solver == "multigrid":
+            _set_ecs_solver(0, self._grid_id, 1)
+        if region._decompose and _set_ecs_decomposition(0, self._grid_id) != 0:
+            raise RxDException(
+                "Extracellular region %r cannot be decomposed, it has fewer x planes than processes"
+                % region
+            )
 
         self._name = name
 
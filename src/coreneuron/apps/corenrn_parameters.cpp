@@ -161,6 +161,10 @@ corenrn_parameters::corenrn_parameters()
         ->check(CLI::Range(-1000., 1e9));
     sub_output->add_option("-o, --outpath", this->outpath, "Path to place output data files.")
         ->capture_default_str();
+    sub_output->add_flag("--binary-spikes",
+                         this->binary_spikes,
+                         "Write spikes to out.bin in the compressed binary format instead of "
+                         "out.dat.");
     sub_output->add_option("--checkpoint",
                            this->checkpointpath,
                            "Enable checkpoint and specify directory to store related files.");
@@ -261,6 +265,7 @@ std::ostream& operator<<(std::ostream& os, const corenrn_parameters& corenrn_par
        << "OUTPUT PARAMETERS" << std::endl
        << "--dt_io=" << corenrn_param.dt_io << std::endl
        << "--outpath=" << corenrn_param.outpath << std::endl
+       << "--binary-spikes=" << (corenrn_param.binary_spikes ? "true" : "false") << std::endl
        << "--checkpoint=" << corenrn_param.checkpointpath << std::endl;
 
     return os;
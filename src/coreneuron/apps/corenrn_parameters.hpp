@@ -72,6 +72,8 @@ struct corenrn_parameters_data {
 
     bool model_stats = false;  /// Print mechanism counts and model size after initialization
 
+    bool binary_spikes = false;  /// Write spikes in the compressed binary format (out.bin).
+
     verbose_level verbose{verbose_level::DEFAULT};  /// Verbosity-level
 
     double tstop = 100;        /// Stop time of simulation in msec
@@ -54,11 +54,16 @@ extern int (*nrn2core_get_dat2_2_)(int tid,
                                    double*& v,
                                    double*& diamvec);
 
+/* With data_stride > 0, data is filled in the CoreNEURON SoA layout: the
+ * values of each variable start at data_stride * (sum of preceding array dims).
+ * With data_stride == 0, data is filled instance by instance (file format).
+ */
 extern int (*nrn2core_get_dat2_mech_)(int tid,
                                       size_t i,
                                       int dsz_inst,
                                       int*& nodeindices,
                                       double*& data,
+                                      int data_stride,
                                       int*& pdata,
                                       std::vector<uint32_t>& nmodlrandom,
                                       std::vector<int>& pointer2type);
@@ -14,6 +14,9 @@
 #include <algorithm>
 #include <numeric>
 #include <limits>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
 
 #include "coreneuron/nrnconf.h"
 #include "coreneuron/io/nrn2core_direct.h"
@@ -24,6 +27,7 @@
 #include "coreneuron/mpi/nrnmpidec.h"
 #include "coreneuron/utils/string_utils.h"
 #include "coreneuron/apps/corenrn_parameters.hpp"
+#include "coreneuron/sim/multicore.hpp"
 #ifdef ENABLE_SONATA_REPORTS
 #include "bbp/sonata/reports.h"
 #endif  // ENABLE_SONATA_REPORTS
@@ -64,27 +68,173 @@ void spikevec_unlock() {
     mut.unlock();
 }
 
+/** Sort (time, gid) pairs by time then gid.
+ *  The vector is cut into one run per thread, the runs are sorted concurrently and then merged
+ *  pairwise, each round of merges also running concurrently.
+ */
+static void parallel_spike_sort(std::vector<std::pair<double, int>>& spikes) {
+    // below this many spikes per run, threading costs more than it saves
+    constexpr std::size_t min_run = 1 << 14;
+    const std::size_t n = spikes.size();
+    const int nrun = static_cast<int>(
+        std::max<std::size_t>(1, std::min<std::size_t>(std::max(nrn_nthread, 1), n / min_run)));
+    std::vector<std::size_t> bounds(nrun + 1);
+    for (int i = 0; i <= nrun; ++i) {
+        bounds[i] = n * i / nrun;
+    }
+    auto begin = spikes.begin();
+    int i;
+    // clang-format off
+    #pragma omp parallel for private(i) shared(spikes, bounds, begin, nrun) schedule(static, 1)
+    for (i = 0; i < nrun; ++i) {
+        std::sort(begin + bounds[i], begin + bounds[i + 1]);
+    }
+    for (int width = 1; width < nrun; width *= 2) {
+        #pragma omp parallel for private(i) shared(spikes, bounds, begin, nrun, width) schedule(static, 1)
+        for (i = 0; i < nrun - width; i += 2 * width) {
+            std::inplace_merge(begin + bounds[i],
+                               begin + bounds[i + width],
+                               begin + bounds[std::min(i + 2 * width, nrun)]);
+        }
+    }
+    // clang-format on
+}
+
 static void local_spikevec_sort(std::vector<double>& isvect,
                                 std::vector<int>& isvecg,
                                 std::vector<double>& osvect,
                                 std::vector<int>& osvecg) {
-    osvect.resize(isvect.size());
-    osvecg.resize(isvecg.size());
-    // first build a permutation vector
-    std::vector<std::size_t> perm(isvect.size());
-    std::iota(perm.begin(), perm.end(), 0);
-    // sort by time then gid
-    std::sort(perm.begin(), perm.end(), [&](std::size_t i, std::size_t j) {
-        return isvect[i] < isvect[j] || (isvect[i] == isvect[j] && isvecg[i] < isvecg[j]);
-    });
-
-    // now apply permutation to time and gid output vectors
-    std::transform(perm.begin(), perm.end(), osvect.begin(), [&](std::size_t i) {
-        return isvect[i];
-    });
-    std::transform(perm.begin(), perm.end(), osvecg.begin(), [&](std::size_t i) {
-        return isvecg[i];
-    });
+    // sort the pairs themselves rather than a permutation, keeps the comparisons cache friendly
+    std::vector<std::pair<double, int>> spikes(isvect.size());
+    for (std::size_t i = 0; i < spikes.size(); ++i) {
+        spikes[i] = {isvect[i], isvecg[i]};
+    }
+    parallel_spike_sort(spikes);
+
+    osvect.resize(spikes.size());
+    osvecg.resize(spikes.size());
+    for (std::size_t i = 0; i < spikes.size(); ++i) {
+        osvect[i] = spikes[i].first;
+        osvecg[i] = spikes[i].second;
+    }
+}
+
+/** Binary spike file (out.bin).
+ *  The file is a sequence of independent blocks, one per writing rank, in rank order. Each block
+ *  is a spike_block_header followed by nbytes of payload. Times are stored as integer multiples
+ *  of header.tick: the first time of the block as a zigzag varint, every following one as the
+ *  varint difference to its predecessor (spikes are sorted by time). Each time is followed by the
+ *  varint gid. Negative gids are not written. Integers are in native byte order.
+ */
+struct spike_block_header {
+    char magic[8];
+    double tick;
+    std::uint64_t count;
+    std::uint64_t nbytes;
+};
+
+static constexpr char spike_block_magic[8] = {'C', 'N', 'S', 'P', 'I', 'K', 'E', '1'};
+// 2^-24 ms, exactly representable and well below the text format's %.8g resolution
+static const double spike_tick = std::ldexp(1.0, -24);
+
+static void put_varint(std::vector<unsigned char>& buf, std::uint64_t x) {
+    while (x >= 0x80) {
+        buf.push_back(static_cast<unsigned char>(x | 0x80));
+        x >>= 7;
+    }
+    buf.push_back(static_cast<unsigned char>(x));
+}
+
+static bool get_varint(const unsigned char*& p, const unsigned char* end, std::uint64_t& x) {
+    x = 0;
+    for (int shift = 0; p < end && shift < 64; shift += 7) {
+        unsigned char c = *p++;
+        x |= std::uint64_t(c & 0x7f) << shift;
+        if (!(c & 0x80)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/// Encode the sorted spikes as one block, appended to buf. Nothing is appended without spikes.
+static void encode_spikes_binary(const std::vector<double>& spiketime,
+                                 const std::vector<int>& spikegid,
+                                 std::vector<unsigned char>& buf) {
+    std::size_t start = buf.size();
+    buf.resize(start + sizeof(spike_block_header));
+    std::uint64_t count = 0;
+    std::int64_t prev = 0;
+    for (std::size_t i = 0; i < spikegid.size(); ++i) {
+        if (spikegid[i] < 0) {
+            continue;
+        }
+        auto ticks = static_cast<std::int64_t>(std::llround(spiketime[i] / spike_tick));
+        if (count == 0) {
+            put_varint(buf, (std::uint64_t(ticks) << 1) ^ std::uint64_t(ticks >> 63));
+        } else {
+            put_varint(buf, std::uint64_t(ticks - prev));
+        }
+        put_varint(buf, std::uint64_t(spikegid[i]));
+        prev = ticks;
+        ++count;
+    }
+    if (count == 0) {
+        buf.resize(start);
+        return;
+    }
+    spike_block_header header{};
+    std::memcpy(header.magic, spike_block_magic, sizeof(header.magic));
+    header.tick = spike_tick;
+    header.count = count;
+    header.nbytes = buf.size() - start - sizeof(spike_block_header);
+    std::memcpy(buf.data() + start, &header, sizeof(header));
+}
+
+bool read_spikes_binary(const std::string& fname,
+                        std::vector<double>& spiketime,
+                        std::vector<int>& spikegid) {
+    spiketime.clear();
+    spikegid.clear();
+    FILE* f = fopen(fname.c_str(), "rb");
+    if (!f) {
+        return false;
+    }
+    std::vector<unsigned char> payload;
+    spike_block_header header;
+    bool ok = true;
+    while (fread(&header, sizeof(header), 1, f) == 1) {
+        if (std::memcmp(header.magic, spike_block_magic, sizeof(header.magic)) != 0) {
+            ok = false;
+            break;
+        }
+        payload.resize(header.nbytes);
+        if (header.nbytes && fread(payload.data(), header.nbytes, 1, f) != 1) {
+            ok = false;
+            break;
+        }
+        const unsigned char* p = payload.data();
+        const unsigned char* end = p + payload.size();
+        std::int64_t ticks = 0;
+        for (std::uint64_t i = 0; ok && i < header.count; ++i) {
+            std::uint64_t dt, gid;
+            ok = get_varint(p, end, dt) && get_varint(p, end, gid);
+            if (i == 0) {
+                ticks = static_cast<std::int64_t>(dt >> 1) ^ -static_cast<std::int64_t>(dt & 1);
+            } else {
+                ticks += static_cast<std::int64_t>(dt);
+            }
+            spiketime.push_back(ticks * header.tick);
+            spikegid.push_back(static_cast<int>(gid));
+        }
+        if (!ok || p != end) {
+            ok = false;
+            break;
+        }
+    }
+    ok = ok && !ferror(f);
+    fclose(f);
+    return ok;
 }
 
 #if NRNMPI
@@ -109,7 +259,7 @@ static void sort_spikes(std::vector<double>& spikevec_time, std::vector<int>& sp
     bin_t = bin_t ? bin_t : 1;
     // first find number of spikes in each time window
     for (const auto& st: spikevec_time) {
-        int idx = (int) (st - min_time) / bin_t;
+        int idx = std::min(static_cast<int>((st - min_time) / bin_t), nrnmpi_numprocs - 1);
         snd_cnts[idx]++;
     }
     for (int i = 1; i < nrnmpi_numprocs; i++) {
@@ -196,7 +346,7 @@ void output_spike_populations(const SpikesInfo& spikes_info) {
  */
 static void output_spikes_parallel(const char* outpath, const SpikesInfo& spikes_info) {
     std::stringstream ss;
-    ss << outpath << "/out.dat";
+    ss << outpath << (corenrn_param.binary_spikes ? "/out.bin" : "/out.dat");
     std::string fname = ss.str();
 
     // remove if file already exist
@@ -213,6 +363,16 @@ static void output_spikes_parallel(const char* outpath, const SpikesInfo& spikes
     sort_spikes(spikevec_time, spikevec_gid);
     nrnmpi_barrier();
 
+    if (corenrn_param.binary_spikes) {
+        // the time bins of sort_spikes follow rank order, so the blocks come out globally sorted
+        std::vector<unsigned char> spike_data;
+        encode_spikes_binary(spikevec_time, spikevec_gid, spike_data);
+        nrnmpi_write_file(fname,
+                          reinterpret_cast<const char*>(spike_data.data()),
+                          spike_data.size());
+        return;
+    }
+
     // each spike record in the file is time + gid (64 chars sufficient)
     const int SPIKE_RECORD_LEN = 64;
     size_t num_spikes = spikevec_gid.size();
@@ -249,7 +409,7 @@ static void output_spikes_parallel(const char* outpath, const SpikesInfo& spikes
 
 static void output_spikes_serial(const char* outpath) {
     std::stringstream ss;
-    ss << outpath << "/out.dat";
+    ss << outpath << (corenrn_param.binary_spikes ? "/out.bin" : "/out.dat");
     std::string fname = ss.str();
 
     // reserve some space for sorted spikevec buffers
@@ -260,12 +420,20 @@ static void output_spikes_serial(const char* outpath) {
     // remove if file already exist
     remove(fname.c_str());
 
-    FILE* f = fopen(fname.c_str(), "w");
+    FILE* f = fopen(fname.c_str(), corenrn_param.binary_spikes ? "wb" : "w");
     if (!f && nrnmpi_myid == 0) {
         std::cout << "WARNING: Could not open file for writing spikes." << std::endl;
         return;
     }
 
+    if (corenrn_param.binary_spikes) {
+        std::vector<unsigned char> spike_data;
+        encode_spikes_binary(sorted_spikevec_time, sorted_spikevec_gid, spike_data);
+        fwrite(spike_data.data(), 1, spike_data.size(), f);
+        fclose(f);
+        return;
+    }
+
     for (std::size_t i = 0; i < sorted_spikevec_gid.size(); ++i)
         if (sorted_spikevec_gid[i] > -1)
             fprintf(f, "%.8g\t%d\n", sorted_spikevec_time[i], sorted_spikevec_gid[i]);
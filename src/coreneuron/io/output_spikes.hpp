@@ -16,6 +16,14 @@ namespace coreneuron {
 void output_spikes(const char* outpath, const SpikesInfo& spikes_info);
 void mk_spikevec_buffer(int);
 
+/** @brief Read a spike file written with --binary-spikes (out.bin)
+ *
+ * @return false if the file cannot be opened or is not a valid spike file
+ */
+bool read_spikes_binary(const std::string& fname,
+                        std::vector<double>& spiketime,
+                        std::vector<int>& spikegid);
+
 extern std::vector<double> spikevec_time;
 extern std::vector<int> spikevec_gid;
 
@@ -50,6 +50,7 @@ int (*nrn2core_get_dat2_mech_)(int tid,
                                int dsz_inst,
                                int*& nodeindices,
                                double*& data,
+                               int data_stride,
                                int*& pdata,
                                std::vector<uint32_t>& nmodlrandom,
                                std::vector<int>& pointer2type);
@@ -299,6 +300,7 @@ void Phase2::read_direct(int thread_id, const NrnThread& nt) {
     delete[] nodecounts_;
 
     check_mechanism();
+    mech_data_in_layout = true;
 
     // TODO: fix it in the future
     int n_data_padded = nrn_soa_padded_size(n_node, SOA_LAYOUT);
@@ -346,7 +348,8 @@ void Phase2::read_direct(int thread_id, const NrnThread& nt) {
         }
         tml.pdata.resize(nodecounts[i] * dparam_sizes[type]);
 
-        int* nodeindices_ = nullptr;
+        // filled in place: nodeindices, pdata, and data already in the SoA layout of populate
+        int* nodeindices_ = tml.nodeindices.empty() ? nullptr : tml.nodeindices.data();
         double* data_ = _data + offset;
         int* pdata_ = const_cast<int*>(tml.pdata.data());
 
@@ -363,6 +366,7 @@ void Phase2::read_direct(int thread_id, const NrnThread& nt) {
                                    dparam_sizes[type] > 0 ? dsz_inst : 0,
                                    nodeindices_,
                                    data_,
+                                   nrn_soa_padded_size(nodecounts[i], layout),
                                    pdata_,
                                    nmodlrandom,
                                    tml.pointer2type);
@@ -371,10 +375,6 @@ void Phase2::read_direct(int thread_id, const NrnThread& nt) {
             dsz_inst++;
         }
         offset += nrn_soa_padded_size(nodecounts[i], layout) * param_sizes[type];
-        if (nodeindices_) {
-            std::copy(nodeindices_, nodeindices_ + nodecounts[i], tml.nodeindices.data());
-            free(nodeindices_);  // not free_memory because this is allocated by NEURON?
-        }
         if (corenrn.get_is_artificial()[type]) {
             assert(nodeindices_ == nullptr);
         }
@@ -1116,7 +1116,9 @@ void Phase2::populate(NrnThread& nt, const UserParams& userParams) {
         ml->nodeindices = (int*) ecalloc_align(ml->nodecount, sizeof(int));
         std::copy(tmls[itml].nodeindices.begin(), tmls[itml].nodeindices.end(), ml->nodeindices);
 
-        mech_data_layout_transform<double>(ml->data, n, array_dims, layout);
+        if (!mech_data_in_layout) {
+            mech_data_layout_transform<double>(ml->data, n, array_dims, layout);
+        }
 
         if (szdp) {
             ml->pdata = (int*) ecalloc_align(nrn_soa_padded_size(n, layout) * szdp, sizeof(int));
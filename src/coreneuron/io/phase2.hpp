@@ -109,6 +109,8 @@ class Phase2 {
     std::vector<double> actual_diam;
     */
     double* _data;
+    // mechanism data of _data already in the layout of populate (direct transfer)
+    bool mech_data_in_layout = false;
     struct TML {
         std::vector<int> nodeindices;
         std::vector<int> pdata;
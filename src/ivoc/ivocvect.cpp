@@ -7,9 +7,12 @@
 #include <cstdlib>
 #include <cmath>
 #include <cerrno>
+#include <cstdint>
+#include <cstring>
 #include <numeric>
 #include <functional>
 #include <string>
+#include <vector>
 
 #include "fourier.h"
 #include "mymath.h"
@@ -401,6 +404,7 @@ int vector_arg_px(int i, double** px) {
 
 extern void nrn_vecsim_add(void*, bool);
 extern void nrn_vecsim_remove(void*);
+extern void nrn_vecsim_load(void*);
 
 static int possible_destvec(int arg, Vect*& dest) {
     if (ifarg(arg) && hoc_is_object_arg(arg)) {
@@ -936,6 +940,12 @@ static Object** v_play(void* v) {
     return vp->temp_objvar();
 }
 
+static Object** v_record_load(void* v) {
+    Vect* vp = (Vect*) v;
+    nrn_vecsim_load(v);
+    return vp->temp_objvar();
+}
+
 /*ARGSUSED*/
 static Object** v_plot(void* v) {
     TRY_GUI_REDIRECT_METHOD_ACTUAL_OBJ("Vector.plot", svec_, v);
@@ -1169,11 +1179,19 @@ static Object** v_histogram(void* v) {
     std::fill(y->begin(), y->end(), 0.);
     //	for (i=0; i< n; i++) y->elem(i) = h.inBucket(i);
 
-    for (i = 0; i < x->size(); ++i) {
-        int ind = int(floor((x->elem(i) - low) / width)) + 1;
-        if (ind >= 0 && ind < y->size()) {
-            y->elem(ind) += 1.0;
-        }
+    // Out of range samples go to a discard bin at n. Four interleaved count
+    // arrays keep runs of equal bins from serializing on one counter.
+    std::vector<std::size_t> count(4 * (n + 1), 0);
+    const double* px = x->data();
+    std::size_t const sz = x->size();
+    for (std::size_t j = 0; j < sz; ++j) {
+        double const d = floor((px[j] - low) / width) + 1.;
+        std::size_t const ind = (d >= 0. && d < n) ? std::size_t(d) : std::size_t(n);
+        ++count[(j & 3) * (n + 1) + ind];
+    }
+    for (i = 0; i < n; ++i) {
+        y->elem(i) = double(count[i] + count[(n + 1) + i] + count[2 * (n + 1) + i] +
+                            count[3 * (n + 1) + i]);
     }
     return y->temp_objvar();
 }
@@ -1576,44 +1594,108 @@ static Object** v_at(void* v) {
 }
 
 
-typedef struct {
+/* Least significant digit radix sort of n doubles by value, used for the
+   large vectors of sort and sortindex. Keys are the IEEE bit patterns mapped
+   so that unsigned order is numeric order, -0 mapping to +0 for a stable
+   sortindex. perm, when given, receives the stable sorting permutation, so
+   equal values keep their original order exactly as a comparison sort on
+   (value, index) would. Passes in which every key has the same digit are
+   skipped, which makes narrow ranges of data cheap.
+*/
+static constexpr std::size_t radix_sort_min = 1 << 12;
+
+static constexpr std::uint64_t radix_sign = std::uint64_t(1) << 63;
+
+static inline std::uint64_t radix_key(double x) {
+    std::uint64_t u;
+    std::memcpy(&u, &x, sizeof u);
+    return (u & radix_sign) ? ~u : (u | radix_sign);
+}
+
+static inline double radix_value(std::uint64_t k) {
+    std::uint64_t const u = (k & radix_sign) ? (k & ~radix_sign) : ~k;
     double x;
-    int i;
-} SortIndex;
+    std::memcpy(&x, &u, sizeof x);
+    return x;
+}
 
-static int sort_index_cmp(const void* a, const void* b) {
-    double x = ((SortIndex*) a)->x;
-    double y = ((SortIndex*) b)->x;
-    if (x > y)
-        return (1);
-    if (x < y)
-        return (-1);
-    return (0);
+static void radix_sort(double* x, std::size_t n, int* perm) {
+    std::vector<std::uint64_t> key(n), key2(n);
+    std::vector<int> idx, idx2;
+    if (perm) {
+        for (std::size_t i = 0; i < n; ++i) {
+            key[i] = radix_key(x[i] == 0. ? 0. : x[i]);
+        }
+        idx.resize(n);
+        idx2.resize(n);
+        std::iota(idx.begin(), idx.end(), 0);
+    } else {
+        // the sorted values themselves are wanted, so -0 keeps its sign
+        for (std::size_t i = 0; i < n; ++i) {
+            key[i] = radix_key(x[i]);
+        }
+    }
+    // 11 bit digits keep each pass's counters in L1. All six digit
+    // histograms are filled in a single read of the keys.
+    constexpr int bits = 11;
+    constexpr int npass = (64 + bits - 1) / bits;
+    constexpr std::uint64_t mask = (std::uint64_t(1) << bits) - 1;
+    std::vector<std::size_t> count(npass * (mask + 1));
+    for (std::size_t i = 0; i < n; ++i) {
+        for (int pass = 0; pass < npass; ++pass) {
+            ++count[pass * (mask + 1) + ((key[i] >> (pass * bits)) & mask)];
+        }
+    }
+    for (int pass = 0; pass < npass; ++pass) {
+        int const shift = pass * bits;
+        std::size_t* const c = count.data() + pass * (mask + 1);
+        if (c[(key[0] >> shift) & mask] == n) {
+            continue;
+        }
+        std::size_t sum = 0;
+        for (std::size_t d = 0; d <= mask; ++d) {
+            std::size_t const t = c[d];
+            c[d] = sum;
+            sum += t;
+        }
+        for (std::size_t i = 0; i < n; ++i) {
+            std::size_t const j = c[(key[i] >> shift) & mask]++;
+            key2[j] = key[i];
+            if (perm) {
+                idx2[j] = idx[i];
+            }
+        }
+        key.swap(key2);
+        idx.swap(idx2);
+    }
+    if (perm) {
+        std::copy(idx.begin(), idx.end(), perm);
+    } else {
+        for (std::size_t i = 0; i < n; ++i) {
+            x[i] = radix_value(key[i]);
+        }
+    }
 }
 
 static Object** v_sortindex(void* v) {
     // v.index(vsrc, vsrc.sortindex) sorts vsrc into v
-    int i, n;
     Vect* x = (Vect*) v;
-    n = x->size();
+    std::size_t const n = x->size();
     Vect* y;
     possible_destvec(1, y);
-    y->resize(n);
 
-    SortIndex* si = new SortIndex[n];
-    for (i = 0; i < n; ++i) {
-        si[i].i = i;
-        si[i].x = x->elem(i);
+    std::vector<int> perm(n);
+    if (n >= radix_sort_min) {
+        radix_sort(x->data(), n, perm.data());
+    } else {
+        std::iota(perm.begin(), perm.end(), 0);
+        const double* px = x->data();
+        std::stable_sort(perm.begin(), perm.end(), [px](int a, int b) { return px[a] < px[b]; });
+    }
+    y->resize(n);
+    for (std::size_t i = 0; i < n; i++) {
+        y->elem(i) = double(perm[i]);
     }
-
-    // On BlueGene
-    // qsort apparently can generate errno 38 "Function not implemented"
-    qsort((void*) si, n, sizeof(SortIndex), sort_index_cmp);
-    errno = 0;
-    for (i = 0; i < n; i++)
-        y->elem(i) = (double) si[i].i;
-
-    delete[] si;
     return y->temp_objvar();
 }
 
@@ -1685,92 +1767,77 @@ static int possible_srcvec(Vect*& src, Vect* dest, int& flag) {
     }
 }
 
-static Object** v_where(void* v) {
-    Vect* y = (Vect*) v;
-    Vect* x;
-    int iarg, flag;
-
-    iarg = possible_srcvec(x, y, flag);
-
-    int n = x->size();
-    int m = 0;
-    int i;
-
-    char* op = gargstr(iarg++);
-    double value = *getarg(iarg++);
-    double value2;
-
-    y->resize(0);
-
+/* The comparators of where, indwhere and indvwhere. Calls f with the
+   predicate for op, so each scan is compiled once per comparator with no
+   branch on op inside the loop. value2 is only read by the interval forms.
+*/
+template <typename F>
+static void where_predicate(const char* op, double value, int iarg2, const char* method, F f) {
+    double const e = hoc_epsilon;
     if (!strcmp(op, "==")) {
-        for (i = 0; i < n; i++) {
-            if (MyMath::eq(x->elem(i), value, hoc_epsilon)) {
-                //	      y->resize_chunk(++m);
-                //	      y->elem(m-1) = x->elem(i);
-                y->push_back(x->elem(i));
-            }
-        }
+        f([=](double x) { return MyMath::eq(x, value, e); });
     } else if (!strcmp(op, "!=")) {
-        for (i = 0; i < n; i++) {
-            if (!MyMath::eq(x->elem(i), value, hoc_epsilon)) {
-                y->push_back(x->elem(i));
-            }
-        }
+        f([=](double x) { return !MyMath::eq(x, value, e); });
     } else if (!strcmp(op, ">")) {
-        for (i = 0; i < n; i++) {
-            if (x->elem(i) > value + hoc_epsilon) {
-                y->push_back(x->elem(i));
-            }
-        }
+        f([=](double x) { return x > value + e; });
     } else if (!strcmp(op, "<")) {
-        for (i = 0; i < n; i++) {
-            if (x->elem(i) < value - hoc_epsilon) {
-                y->push_back(x->elem(i));
-            }
-        }
+        f([=](double x) { return x < value - e; });
     } else if (!strcmp(op, ">=")) {
-        for (i = 0; i < n; i++) {
-            if (x->elem(i) >= value - hoc_epsilon) {
-                y->push_back(x->elem(i));
-            }
-        }
+        f([=](double x) { return x >= value - e; });
     } else if (!strcmp(op, "<=")) {
-        for (i = 0; i < n; i++) {
-            if (x->elem(i) <= value + hoc_epsilon) {
-                y->push_back(x->elem(i));
-            }
-        }
+        f([=](double x) { return x <= value + e; });
     } else if (!strcmp(op, "()")) {
-        value2 = *getarg(iarg);
-        for (i = 0; i < n; i++) {
-            if ((x->elem(i) > value + hoc_epsilon) && (x->elem(i) < value2 - hoc_epsilon)) {
-                y->push_back(x->elem(i));
-            }
-        }
+        double const value2 = *getarg(iarg2);
+        f([=](double x) { return (x > value + e) && (x < value2 - e); });
     } else if (!strcmp(op, "[]")) {
-        value2 = *getarg(iarg);
-        for (i = 0; i < n; i++) {
-            if ((x->elem(i) >= value - hoc_epsilon) && (x->elem(i) <= value2 + hoc_epsilon)) {
-                y->push_back(x->elem(i));
-            }
-        }
+        double const value2 = *getarg(iarg2);
+        f([=](double x) { return (x >= value - e) && (x <= value2 + e); });
     } else if (!strcmp(op, "[)")) {
-        value2 = *getarg(iarg);
-        for (i = 0; i < n; i++) {
-            if ((x->elem(i) >= value - hoc_epsilon) && (x->elem(i) < value2 - hoc_epsilon)) {
-                y->push_back(x->elem(i));
-            }
-        }
+        double const value2 = *getarg(iarg2);
+        f([=](double x) { return (x >= value - e) && (x < value2 - e); });
     } else if (!strcmp(op, "(]")) {
-        value2 = *getarg(iarg);
-        for (i = 0; i < n; i++) {
-            if ((x->elem(i) > value + hoc_epsilon) && (x->elem(i) <= value2 + hoc_epsilon)) {
-                y->push_back(x->elem(i));
-            }
-        }
+        double const value2 = *getarg(iarg2);
+        f([=](double x) { return (x > value + e) && (x <= value2 + e); });
     } else {
-        hoc_execerror("Vector", "Invalid comparator in .where()\n");
+        hoc_execerror("Vector", (std::string("Invalid comparator in .") + method + "()\n").c_str());
     }
+}
+
+/* y = get(i) for every i where pred(x[i]), in order. A counting pass sizes
+   y exactly, then a branch free pass writes every candidate and advances the
+   output only on a match, so both loops vectorize. y may be x.
+*/
+template <typename Pred, typename Get>
+static void where_compact(Vect* x, Vect* y, Pred pred, Get get) {
+    std::size_t const n = x->size();
+    const double* px = x->data();
+    std::size_t m = 0;
+    for (std::size_t i = 0; i < n; ++i) {
+        m += pred(px[i]);
+    }
+    double* out = px == y->data() ? y->data() : (y->resize(m + 1), y->data());
+    std::size_t k = 0;
+    for (std::size_t i = 0; i < n; ++i) {
+        bool const keep = pred(px[i]);
+        out[k] = get(px, i);
+        k += keep;
+    }
+    y->resize(m);
+}
+
+static Object** v_where(void* v) {
+    Vect* y = (Vect*) v;
+    Vect* x;
+    int iarg, flag;
+
+    iarg = possible_srcvec(x, y, flag);
+
+    char* op = gargstr(iarg++);
+    double value = *getarg(iarg++);
+
+    where_predicate(op, value, iarg, "where", [&](auto pred) {
+        where_compact(x, y, pred, [](const double* px, std::size_t i) { return px[i]; });
+    });
     if (flag) {
         delete x;
     }
@@ -1779,171 +1846,32 @@ static Object** v_where(void* v) {
 
 static double v_indwhere(void* v) {
     Vect* x = (Vect*) v;
-    int i, iarg, m = 0;
-    char* op;
-    double value, value2;
     hoc_return_type_code = HocReturnType::integer;
-    op = gargstr(1);
-    value = *getarg(2);
-    iarg = 3;
-
-    int n = x->size();
+    char* op = gargstr(1);
+    double value = *getarg(2);
 
-
-    if (!strcmp(op, "==")) {
-        for (i = 0; i < n; i++) {
-            if (MyMath::eq(x->elem(i), value, hoc_epsilon)) {
-                return i;
-            }
-        }
-    } else if (!strcmp(op, "!=")) {
-        for (i = 0; i < n; i++) {
-            if (!MyMath::eq(x->elem(i), value, hoc_epsilon)) {
-                return i;
-            }
-        }
-    } else if (!strcmp(op, ">")) {
-        for (i = 0; i < n; i++) {
-            if (x->elem(i) > value + hoc_epsilon) {
-                return i;
-            }
-        }
-    } else if (!strcmp(op, "<")) {
-        for (i = 0; i < n; i++) {
-            if (x->elem(i) < value - hoc_epsilon) {
-                return i;
-            }
-        }
-    } else if (!strcmp(op, ">=")) {
-        for (i = 0; i < n; i++) {
-            if (x->elem(i) >= value - hoc_epsilon) {
-                return i;
-            }
-        }
-    } else if (!strcmp(op, "<=")) {
-        for (i = 0; i < n; i++) {
-            if (x->elem(i) <= value + hoc_epsilon) {
-                return i;
-            }
+    double result = -1.;
+    where_predicate(op, value, 3, "indwhere", [&](auto pred) {
+        auto const it = std::find_if(x->begin(), x->end(), pred);
+        if (it != x->end()) {
+            result = double(it - x->begin());
         }
-    } else if (!strcmp(op, "()")) {
-        value2 = *getarg(iarg);
-        for (i = 0; i < n; i++) {
-            if ((x->elem(i) > value + hoc_epsilon) && (x->elem(i) < value2 - hoc_epsilon)) {
-                return i;
-            }
-        }
-    } else if (!strcmp(op, "[]")) {
-        value2 = *getarg(iarg);
-        for (i = 0; i < n; i++) {
-            if ((x->elem(i) >= value - hoc_epsilon) && (x->elem(i) <= value2 + hoc_epsilon)) {
-                return i;
-            }
-        }
-    } else if (!strcmp(op, "[)")) {
-        value2 = *getarg(iarg);
-        for (i = 0; i < n; i++) {
-            if ((x->elem(i) >= value - hoc_epsilon) && (x->elem(i) < value2 - hoc_epsilon)) {
-                return i;
-            }
-        }
-    } else if (!strcmp(op, "(]")) {
-        value2 = *getarg(iarg);
-        for (i = 0; i < n; i++) {
-            if ((x->elem(i) > value + hoc_epsilon) && (x->elem(i) <= value2 + hoc_epsilon)) {
-                return i;
-            }
-        }
-    } else {
-        hoc_execerror("Vector", "Invalid comparator in .indwhere()\n");
-    }
-
-    return -1.;
+    });
+    return result;
 }
 
 static Object** v_indvwhere(void* v) {
     Vect* y = (Vect*) v;
     Vect* x;
-    int i, iarg, m = 0, flag;
-    char* op;
-    double value, value2;
+    int iarg, flag;
 
     iarg = possible_srcvec(x, y, flag);
-    op = gargstr(iarg++);
-    value = *getarg(iarg++);
-    y->resize(0);
-
-    int n = x->size();
-
-
-    if (!strcmp(op, "==")) {
-        for (i = 0; i < n; i++) {
-            if (MyMath::eq(x->elem(i), value, hoc_epsilon)) {
-                y->push_back(i);
-            }
-        }
-    } else if (!strcmp(op, "!=")) {
-        for (i = 0; i < n; i++) {
-            if (!MyMath::eq(x->elem(i), value, hoc_epsilon)) {
-                y->push_back(i);
-            }
-        }
-    } else if (!strcmp(op, ">")) {
-        for (i = 0; i < n; i++) {
-            if (x->elem(i) > value + hoc_epsilon) {
-                y->push_back(i);
-            }
-        }
-    } else if (!strcmp(op, "<")) {
-        for (i = 0; i < n; i++) {
-            if (x->elem(i) < value - hoc_epsilon) {
-                y->push_back(i);
-            }
-        }
-    } else if (!strcmp(op, ">=")) {
-        for (i = 0; i < n; i++) {
-            if (x->elem(i) >= value - hoc_epsilon) {
-                y->push_back(i);
-            }
-        }
-    } else if (!strcmp(op, "<=")) {
-        for (i = 0; i < n; i++) {
-            if (x->elem(i) <= value + hoc_epsilon) {
-                y->push_back(i);
-            }
-        }
-    } else if (!strcmp(op, "()")) {
-        value2 = *getarg(iarg);
-        for (i = 0; i < n; i++) {
-            if ((x->elem(i) > value + hoc_epsilon) && (x->elem(i) < value2 - hoc_epsilon)) {
-                y->push_back(i);
-            }
-        }
-    } else if (!strcmp(op, "[]")) {
-        value2 = *getarg(iarg);
-        for (i = 0; i < n; i++) {
-            if ((x->elem(i) >= value - hoc_epsilon) && (x->elem(i) <= value2 + hoc_epsilon)) {
-                y->push_back(i);
-            }
-        }
-    } else if (!strcmp(op, "[)")) {
-        value2 = *getarg(iarg);
-        for (i = 0; i < n; i++) {
-            if ((x->elem(i) >= value - hoc_epsilon) && (x->elem(i) < value2 - hoc_epsilon)) {
-                y->push_back(i);
-            }
-        }
-    } else if (!strcmp(op, "(]")) {
-        value2 = *getarg(iarg);
-        for (i = 0; i < n; i++) {
-            if ((x->elem(i) > value + hoc_epsilon) && (x->elem(i) <= value2 + hoc_epsilon)) {
-                y->push_back(i);
-            }
-        }
-    } else {
-        hoc_execerror("Vector", "Invalid comparator in .indvwhere()\n");
-    }
+    char* op = gargstr(iarg++);
+    double value = *getarg(iarg++);
 
+    where_predicate(op, value, iarg, "indvwhere", [&](auto pred) {
+        where_compact(x, y, pred, [](const double*, std::size_t i) { return double(i); });
+    });
     if (flag) {
         delete x;
     }
@@ -2058,9 +1986,12 @@ static Object** v_apply(void* v) {
                 hoc_execerror(func, " is undefined");
             }
         }
-        for (int i = start; i <= end; i++) {
-            hoc_pushx(x->elem(i));
-            x->elem(i) = hoc_call_objfunc(s, 1, ob);
+        // pure arithmetic funcs and built in functions run without the interpreter
+        if (!hoc_apply_func(s, ob, x->data() + start, end - start + 1)) {
+            for (int i = start; i <= end; i++) {
+                hoc_pushx(x->elem(i));
+                x->elem(i) = hoc_call_objfunc(s, 1, ob);
+            }
         }
     } else if (hoc_is_object_arg(1) && nrnpy_call_func) {
         Object* funcobj = *hoc_objgetarg(1);
@@ -3078,19 +3009,19 @@ static Object** v_spikebin(void* v) {
         ans->resize(n);
     std::fill(ans->begin(), ans->end(), 0.);
 
-    int firing = 0;
-    int k;
-
+    // A bin is 1 if it holds an upward threshold crossing. NaN leaves the
+    // firing state unchanged, as neither comparison holds.
+    bool firing = false;
+    const double* px = v1->data();
     for (int i = 0; i < n; i++) {
+        bool hit = false;
         for (int j = 0; j < bin; j++) {
-            k = i * bin + j;
-            if (v1->elem(k) >= thresh && !firing) {
-                firing = 1;
-                ans->elem(i) = 1;
-            } else if (firing && v1->elem(k) < thresh) {
-                firing = 0;
-            }
+            double const x = px[i * bin + j];
+            bool const up = x >= thresh;
+            hit |= up & !firing;
+            firing = up | (firing & !(x < thresh));
         }
+        ans->elem(i) = hit;
     }
 
     return ans->temp_objvar();
@@ -3324,7 +3255,11 @@ static double v_median(void* v) {
 
 static Object** v_sort(void* v) {
     Vect* ans = (Vect*) v;
-    std::sort(ans->begin(), ans->end());
+    if (ans->size() >= radix_sort_min) {
+        radix_sort(ans->data(), ans->size(), nullptr);
+    } else {
+        std::sort(ans->begin(), ans->end());
+    }
     return ans->temp_objvar();
 }
 
@@ -3821,6 +3756,7 @@ static Member_ret_obj_func v_retobj_members[] = {{"c", v_c},
                                                  {"ploterr", v_ploterr},
 
                                                  {"record", v_record},
+                                                 {"record_load", v_record_load},
                                                  {"play", v_play},
 
                                                  {"from_python", v_from_python},
@@ -4,8 +4,15 @@
 #include "nrnoc_ml.h"
 
 #include <array>
+#include <cstdint>
 
 namespace neuron::cache {
+namespace detail {
+/**
+ * @brief Offset used by MechanismInstance, whose pdata caches hold one pointer per field.
+ */
+inline constexpr std::uint32_t zero_pdata_index{};
+}  // namespace detail
 /**
  * @brief Call the given method with each dparam index that should be cached for a mechanism.
  *
@@ -51,9 +58,10 @@ struct MechanismRange {
      */
     MechanismRange(neuron::model_sorted_token const& cache_token, Memb_list& ml)
         : MechanismRange{ml.type(), ml.get_storage_offset()} {
-        auto const& ptr_cache = mechanism::_get::_pdata_ptr_cache_data(cache_token, ml.type());
-        m_pdata_ptrs = ptr_cache.data();
-        assert(ptr_cache.size() <= NumDatumFields);
+        auto const& base = mechanism::_get::_pdata_base_data(cache_token, ml.type());
+        m_pdata_base = base.data();
+        m_pdata_index = mechanism::_get::_pdata_index_data(cache_token, ml.type()).data();
+        assert(base.size() <= NumDatumFields);
     }
 
     /** Deprecated. */
@@ -145,13 +153,29 @@ struct MechanismRange {
     template <int variable>
     [[nodiscard]] double* dptr_field(std::size_t instance) {
         static_assert(variable < NumDatumFields);
-        return m_pdata_ptrs[variable][m_dptr_offset + instance];
+        return m_pdata_base[variable] + m_pdata_index[variable][m_dptr_offset + instance];
+    }
+
+    /**
+     * @brief Get the start of the column a POINTER variable refers into.
+     * @see dptr_field_index
+     */
+    template <int variable>
+    [[nodiscard]] double* dptr_field_base() {
+        static_assert(variable < NumDatumFields);
+        return m_pdata_base[variable];
     }
 
+    /**
+     * @brief Get the offsets of a POINTER variable for the instances in this range.
+     *
+     * The pointer for the i-th instance is
+     * @c dptr_field_base<variable>() @c + @c dptr_field_index<variable>()[i].
+     */
     template <int variable>
-    [[nodiscard]] double* const* dptr_field_ptr() {
+    [[nodiscard]] std::uint32_t const* dptr_field_index() {
         static_assert(variable < NumDatumFields);
-        return m_pdata_ptrs[variable] + m_dptr_offset;
+        return m_pdata_index[variable] + m_dptr_offset;
     }
 
   protected:
@@ -172,13 +196,20 @@ struct MechanismRange {
     int const* m_data_array_dims{};
 
     /**
-     * @brief Pointer to a range of pointers to the start of POINTER variable caches.
+     * @brief Pointer to a range of pointers to the columns POINTER variables refer into.
      *
-     * @c m_pdata_ptrs[i][j] is the @c double* corresponding to the @f$\texttt{i}^{th}@f$ @c pdata /
-     * @c dparam field and the @f$\texttt{j}^{th}@f$ instance of the mechanism in the program.
-     * @see MechanismInstance::MechanismInstance(Prop*) and @ref nrn_sort_mech_data.
+     * @c m_pdata_base[i] @c + @c m_pdata_index[i][j] is the @c double* corresponding to the
+     * @f$\texttt{i}^{th}@f$ @c pdata / @c dparam field and the @f$\texttt{j}^{th}@f$ instance of
+     * the mechanism in the program.
+     * @see MechanismInstance::MechanismInstance(Prop*) and @ref nrn_fill_mech_data_caches.
+     */
+    double* const* m_pdata_base{};
+
+    /**
+     * @brief Pointer to a range of pointers to the start of POINTER variable offsets.
+     * @see m_pdata_base
      */
-    double* const* const* m_pdata_ptrs{};
+    std::uint32_t const* const* m_pdata_index{};
 
     /**
      * @brief Offset of this contiguous range of mechanism instances into the global range.
@@ -203,7 +234,7 @@ struct MechanismRange {
  * *not* require a call to nrn_ensure_model_data_are_sorted(). This is conceptually fine, as if
  * we are only concerned with a single mechanism instance then it doesn't matter where it lives
  * in the global storage vectors. In this case, @ref m_dptr_cache contains an array of pointers
- * that @ref m_dptr_datums can refer to.
+ * that are used as column starts with a zero offset.
  */
 template <std::size_t NumFloatingPointFields, std::size_t NumDatumFields>
 struct MechanismInstance: MechanismRange<NumFloatingPointFields, NumDatumFields> {
@@ -226,10 +257,10 @@ struct MechanismInstance: MechanismRange<NumFloatingPointFields, NumDatumFields>
             assert(field < NumDatumFields);
             auto& datum = _nrn_mechanism_access_dparam(prop)[field];
             m_dptr_cache[field] = datum.template get<double*>();
-            this->m_dptr_datums[field] = &(m_dptr_cache[field]);
         });
 
-        this->m_pdata_ptrs = m_dptr_datums.data();
+        this->m_pdata_base = m_dptr_cache.data();
+        this->m_pdata_index = m_dptr_zero_index.data();
     }
 
     /**
@@ -243,8 +274,8 @@ struct MechanismInstance: MechanismRange<NumFloatingPointFields, NumDatumFields>
      * @brief Copy assignment
      *
      * This has to be implemented manually because the base class (MechanismInstance) member @ref
-     * m_pdata_ptrs has to be updated to point at the derived class (MechanismInstance) member @ref
-     * m_dptr_datums.
+     * m_pdata_base has to be updated to point at the derived class (MechanismInstance) member @ref
+     * m_dptr_cache.
      */
     MechanismInstance& operator=(MechanismInstance const& other) {
         if (this != &other) {
@@ -253,10 +284,8 @@ struct MechanismInstance: MechanismRange<NumFloatingPointFields, NumDatumFields>
             this->m_data_offset = other.m_data_offset;
             this->m_dptr_offset = other.m_dptr_offset;
             m_dptr_cache = other.m_dptr_cache;
-            for (auto i = 0; i < NumDatumFields; ++i) {
-                m_dptr_datums[i] = &m_dptr_cache[i];
-            }
-            this->m_pdata_ptrs = m_dptr_datums.data();
+            this->m_pdata_base = m_dptr_cache.data();
+            this->m_pdata_index = m_dptr_zero_index.data();
         }
         return *this;
     }
@@ -268,11 +297,15 @@ struct MechanismInstance: MechanismRange<NumFloatingPointFields, NumDatumFields>
     std::array<double*, NumDatumFields> m_dptr_cache{};
 
     /**
-     * @brief Pointers to m_dptr_cache needed to satisfy MechanismRange's requirements.
-     * @invariant @ref m_dptr_datums[i] is equal to &@ref m_dptr_cache[i] for all @c i.
-     * @invariant @c MechanismInstance::m_pdata_ptrs is equal to @ref m_dptr_datums.%data().
+     * @brief Offsets for the single instance, all pointing at zero.
+     * @invariant @c MechanismInstance::m_pdata_base is equal to @ref m_dptr_cache.%data().
+     * @invariant @c MechanismInstance::m_pdata_index is equal to @ref m_dptr_zero_index.%data().
      */
-    std::array<double* const*, NumDatumFields> m_dptr_datums{};
+    std::array<std::uint32_t const*, NumDatumFields> m_dptr_zero_index{[] {
+        std::array<std::uint32_t const*, NumDatumFields> ret{};
+        ret.fill(&detail::zero_pdata_index);
+        return ret;
+    }()};
 };
 }  // namespace neuron::cache
 
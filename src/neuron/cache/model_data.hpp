@@ -1,4 +1,5 @@
 #pragma once
+#include <cstdint>
 #include <optional>
 #include <vector>
 
@@ -12,16 +13,26 @@ using Datum = neuron::container::generic_data_handle;
 namespace neuron::cache {
 struct Mechanism {
     /**
-     * @brief Raw pointers into pointer data for use during simulation.
+     * @brief Start of the column each cached pdata variable points into.
      *
-     * pdata_ptr_cache contains pointers to the start of the storage for each pdata variable that is
-     * flattened into the pdata member of this struct, and nullptr elsewhere. Compared to using
-     * pdata directly this avoids exposing details such as the container used.
+     * Every instance's pointer for a given pdata field points into the same column (of ion data,
+     * Node data or diam), so the pointer for the i-th instance is pdata_base[field] +
+     * pdata_index_ptr[field][i]. Fields that are not cached hold nullptr. Compared to using the Datum
+     * in pdata directly this avoids exposing details such as the container used, and 32 bit
+     * offsets take half the space of raw pointers.
      */
-    std::vector<double* const*> pdata_ptr_cache{};
-    std::vector<std::vector<double*>> pdata{};      // raw pointers for use during simulation
+    std::vector<double*> pdata_base{};
+    /**
+     * @brief Per-field starts of the flattened offsets in pdata_index, nullptr elsewhere.
+     */
+    std::vector<std::uint32_t const*> pdata_index_ptr{};
+    std::vector<std::uint32_t> pdata_index{};  // offsets for all cached fields, one block per field
     std::vector<std::vector<Datum*>> pdata_hack{};  // temporary storage used when populating pdata;
                                                     // should go away when pdata are SoA
+    /**
+     * @brief layout_generation() of the mechanism data when the cache was built.
+     */
+    std::size_t layout_generation{};
 };
 struct Thread {
     /**
@@ -36,8 +47,41 @@ struct Thread {
 struct Model {
     std::vector<Thread> thread{};
     std::vector<Mechanism> mechanism{};
+    /**
+     * @brief Distinguishes successive caches.
+     *
+     * Raw pointers into model data obtained while one cache is valid stay
+     * valid as long as the cache with the same generation is in use.
+     */
+    std::size_t generation{};
+    /**
+     * @brief layout_generation() of the Node data when the cache was built.
+     */
+    std::size_t node_layout_generation{};
 };
 extern std::optional<Model> model;
+/**
+ * @brief The last valid cache, kept when the model becomes unsorted.
+ *
+ * nrn_ensure_model_data_are_sorted reuses the entries of mechanism types
+ * whose data, and the data their cached pointers refer to, have not moved.
+ */
+extern std::optional<Model> stale_model;
+/**
+ * @brief Invalidate the cache, keeping it as stale_model.
+ */
+void invalidate();
+/**
+ * @brief What the last rebuild of the cache had to do.
+ */
+struct SortStats {
+    bool nodes{};                        // Node data were permuted or reallocated
+    std::size_t mechanisms_sorted{};     // types whose data were sorted and caches rebuilt
+    std::size_t mechanisms_reused{};     // types whose cache entries were carried over
+    double seconds{};                    // wall time of the rebuild
+    std::size_t generation{};            // generation of the rebuilt cache
+};
+extern SortStats last_sort;
 }  // namespace neuron::cache
 namespace neuron::container {
 cache::ModelMemoryUsage memory_usage(const std::optional<neuron::cache::Model>& model);
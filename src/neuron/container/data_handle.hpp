@@ -178,6 +178,15 @@ struct data_handle {
         return m_offset.current_row();
     }
 
+    /**
+     * @brief Get the start of the column this handle points into.
+     *
+     * Returns nullptr unless the handle refers to a valid row of an soa<...> container.
+     */
+    [[nodiscard]] T* column_data() const {
+        return bool{m_offset} ? const_cast<T*>(container_data()) : nullptr;
+    }
+
   private:
     // Try and cover the different operator* and operator T* cases with/without
     // const in a more composable way
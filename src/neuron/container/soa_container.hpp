@@ -9,6 +9,7 @@
 #include <cstddef>
 #include <functional>
 #include <limits>
+#include <memory>
 #include <mutex>
 #include <string_view>
 #include <type_traits>
@@ -768,6 +769,12 @@ struct soa {
         if (m_frozen_count) {
             throw_error("shrink() called on a frozen structure");
         }
+        {
+            // Rows do not move, but raw pointers into the columns do.
+            std::lock_guard _{m_mut};
+            ++m_layout_generation;
+            detach_pinned_storage();
+        }
         for_each_vector<detail::may_cause_reallocation::Yes>(
             [](auto const& tag, auto& vec, int field_index, int array_dim) {
                 vec.shrink_to_fit();
@@ -790,6 +797,8 @@ struct soa {
             throw_error("erase() called on a frozen structure");
         }
         mark_as_unsorted_impl<true>();
+        ++m_layout_generation;
+        detach_pinned_storage();
         auto const old_size = size();
         assert(i < old_size);
         if (i != old_size - 1) {
@@ -999,6 +1008,8 @@ struct soa {
      * that some external change to an input of the (external) algorithm
      * defining the sort order can mean that the data are no longer considered
      * sorted, even if nothing has actually changed inside this container.
+     * The next sort may then permute the rows, so this also changes
+     * layout_generation() and anything cached per row must be rebuilt.
      *
      * This method can only be called if the container is not frozen.
      */
@@ -1006,6 +1017,7 @@ struct soa {
         // Lock access to m_frozen_count and m_sorted.
         std::lock_guard _{m_mut};
         mark_as_unsorted_impl<false>();
+        ++m_layout_generation;
     }
 
     /**
@@ -1033,6 +1045,45 @@ struct soa {
         return m_sorted;
     }
 
+    /**
+     * @brief Query a counter that changes whenever rows may have moved.
+     *
+     * If two calls return the same value then no rows were added, removed or
+     * permuted in between, so the i-th row of every column still belongs to
+     * the same object. This is weaker than being sorted: it says nothing about
+     * the sort order, only that it did not change.
+     */
+    [[nodiscard]] std::size_t layout_generation() const {
+        std::lock_guard _{m_mut};
+        return m_layout_generation;
+    }
+
+    /**
+     * @brief Keep the current storage alive for a zero-copy view of it.
+     *
+     * Until the matching unpin_storage(), the next operation that moves rows
+     * or may reallocate the columns first moves them aside and continues on
+     * a copy, so that raw pointers handed out before (e.g. to numpy) do not
+     * dangle. Those pointers then see the values as they were at that point.
+     */
+    void pin_storage() {
+        std::lock_guard _{m_mut};
+        ++m_pin_count;
+        m_storage_pinned = true;
+    }
+
+    /**
+     * @brief Release a pin_storage(); the last one frees the storage moved aside.
+     */
+    void unpin_storage() {
+        std::lock_guard _{m_mut};
+        assert(m_pin_count);
+        if (--m_pin_count == 0) {
+            m_storage_pinned = false;
+            m_detached_storage.clear();
+        }
+    }
+
     /**
      * @brief Permute the SoA-format data using an arbitrary range of integers.
      * @param permutation The reverse permutation vector to apply.
@@ -1074,6 +1125,7 @@ struct soa {
                 "apply_reverse_permutation() given a token that was not the only valid one");
         }
         if (!is_trivial) {
+            detach_pinned_storage();
             // Now we apply the reverse permutation in `permutation` to all of the columns in the
             // container. This is the algorithm from boost::algorithm::apply_reverse_permutation.
             for (std::size_t i = 0; i < my_size; ++i) {
@@ -1094,6 +1146,7 @@ struct soa {
             for (auto i = 0ul; i < my_size; ++i) {
                 m_indices[i].set_current_row(i);
             }
+            ++m_layout_generation;
             // If the container was previously marked sorted, and we have just
             // applied a non-trivial permutation to it, then we need to call the
             // callback if it exists (to invalidate any caches based on the old
@@ -1166,6 +1219,8 @@ struct soa {
         //    invalidated -- adding a new entry to the end of the container
         //    never invalidates indices
         mark_as_unsorted_impl<true>();
+        ++m_layout_generation;
+        detach_pinned_storage();
         // Append to all of the vectors
         auto const old_size = size();
         for_each_vector<detail::may_cause_reallocation::Yes>(
@@ -1185,6 +1240,23 @@ struct soa {
         return index;
     }
 
+    /**
+     * @brief Move pinned columns aside before rows move or they are reallocated.
+     * @note The *caller* is expected to hold m_mut when this is called.
+     */
+    void detach_pinned_storage() {
+        if (!m_storage_pinned) {
+            return;
+        }
+        m_storage_pinned = false;
+        for_each_vector<detail::may_cause_reallocation::Yes>(
+            [this](auto const& tag, auto& vec, auto field_index, auto array_dim) {
+                auto old = std::make_shared<std::decay_t<decltype(vec)>>(std::move(vec));
+                vec = *old;
+                m_detached_storage.push_back(std::move(old));
+            });
+    }
+
   public:
     /**
      * @brief Get a non-owning identifier to the offset-th entry.
@@ -1592,6 +1664,26 @@ struct soa {
      */
     std::size_t m_frozen_count{};
 
+    /**
+     * @brief Counter for layout_generation(), protected by m_mut.
+     */
+    std::size_t m_layout_generation{};
+
+    /**
+     * @brief Number of pin_storage() calls not yet matched by unpin_storage().
+     */
+    std::size_t m_pin_count{};
+
+    /**
+     * @brief True if the current columns were pinned since they were last moved aside.
+     */
+    bool m_storage_pinned{false};
+
+    /**
+     * @brief Columns moved aside by detach_pinned_storage(), kept while pinned.
+     */
+    std::vector<std::shared_ptr<void>> m_detached_storage{};
+
     /**
      * @brief Pointers to identifiers that record the current physical row.
      */
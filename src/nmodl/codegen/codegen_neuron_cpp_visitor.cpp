@@ -933,7 +933,7 @@ std::string CodegenNeuronCppVisitor::int_variable_name(const IndexVariableInfo&
         return fmt::format("_ppvar[{}]", position);
     }
     if (use_instance) {
-        return fmt::format("(*inst.{}[id])", name);
+        return fmt::format("inst.{}_base[inst.{}[id]]", name, name);
     }
 
 
@@ -1789,10 +1789,15 @@ void CodegenNeuronCppVisitor::print_mechanism_range_var_structure(bool print_ini
             // In NEURON we don't create caches for `int*`. Hence, do nothing.
         } else if (info.semantics[position].name == naming::POINTER_SEMANTIC) {
             // we don't need these either.
+        } else if (var.is_vdata) {
+            auto qualifier = var.is_constant ? "const " : "";
+            printer->fmt_line("{}void** const* {}{};", qualifier, name, value_initialize);
         } else {
+            // column start and 32 bit offsets into it, see neuron::cache::Mechanism
             auto qualifier = var.is_constant ? "const " : "";
-            auto type = var.is_vdata ? "void*" : default_float_data_type();
-            printer->fmt_line("{}{}* const* {}{};", qualifier, type, name, value_initialize);
+            printer->fmt_line(
+                "{}{}* {}_base{};", qualifier, default_float_data_type(), name, value_initialize);
+            printer->fmt_line("const std::uint32_t* {}{};", name, value_initialize);
         }
     }
 
@@ -1849,7 +1854,10 @@ void CodegenNeuronCppVisitor::print_make_instance() const {
             } else if (sem == naming::POINTER_SEMANTIC) {
                 return "";
             } else {
-                return fmt::format("_lmc->template dptr_field_ptr<{}>()", i);
+                return fmt::format(
+                    "_lmc->template dptr_field_base<{}>(),\n_lmc->template dptr_field_index<{}>()",
+                    i,
+                    i);
             }
         }();
         if (variable != "") {
@@ -5,6 +5,7 @@
 
 void cvode_finitialize();
 extern void (*nrn_multisplit_setup_)();
+extern void nrn_multisplit_reduce_solve();
 
 #include <cmath>
 #include <cstdlib>
@@ -569,6 +570,15 @@ static double poolshrink(void*) {
     return double(i);
 }
 
+static double record_chunk(void*) {
+    extern size_t nrn_record_stream_chunk(size_t);
+    size_t n = 0;
+    if (ifarg(1)) {
+        n = size_t(chkarg(1, 1., 1e9));
+    }
+    return double(nrn_record_stream_chunk(n));
+}
+
 static double free_event_queues(void*) {
     free_event_queues();
     return 0;
@@ -593,6 +603,7 @@ static Member_func members[] = {{"solve", solve},
                                 {"use_local_dt", use_local_dt},
                                 {"record", n_record},
                                 {"record_remove", n_remove},
+                                {"record_chunk", record_chunk},
                                 {"debug_event", debug_event},
                                 {"order", order},
                                 {"use_daspk", use_daspk},
@@ -680,7 +691,6 @@ static CVRhsFn pf_;
 
 static void msolve_thread(neuron::model_sorted_token const&, NrnThread&);
 static void* msolve_thread_part1(NrnThread*);
-static void* msolve_thread_part2(NrnThread*);
 static void* msolve_thread_part3(NrnThread*);
 static void f_thread(neuron::model_sorted_token const&, NrnThread&);
 static void f_thread_transfer_part1(neuron::model_sorted_token const&, NrnThread&);
@@ -1510,7 +1520,7 @@ static int msolve(CVodeMem m, N_Vector b, N_Vector weight, N_Vector ycur, N_Vect
     msolve_ycur_ = ycur;
     if (nrn_multisplit_setup_ && nrn_nthread > 1) {
         nrn_multithread_job(msolve_thread_part1);
-        nrn_multithread_job(msolve_thread_part2);
+        nrn_multisplit_reduce_solve();
         nrn_multithread_job(msolve_thread_part3);
     } else {
         nrn_multithread_job(sorted_token, msolve_thread);
@@ -1551,11 +1561,6 @@ static void* msolve_thread_part1(NrnThread* nt) {
     cv->solvex_thread_part1(cv->n_vector_data(msolve_b_, i), nt);
     return 0;
 }
-static void* msolve_thread_part2(NrnThread* nt) {
-    Cvode* cv = msolve_cv_;
-    cv->solvex_thread_part2(nt);
-    return 0;
-}
 static void* msolve_thread_part3(NrnThread* nt) {
     int i = nt->id;
     Cvode* cv = msolve_cv_;
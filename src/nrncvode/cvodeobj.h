@@ -16,6 +16,7 @@ typedef std::vector<PreSyn*> PreSynList;
 struct BAMech;
 struct NrnThread;
 class PlayRecord;
+class RecordBatch;
 class STEList;
 namespace neuron {
 struct model_sorted_token;
@@ -91,7 +92,7 @@ class CvodeThreadData {
     int nonvint_offset_;        // synonym for neq_v_. Beginning of this threads nonvint variables.
     int nonvint_extra_offset_;  // extra states (probably Python). Not scattered or gathered.
     std::vector<PlayRecord*>* play_;
-    std::vector<PlayRecord*>* record_;
+    RecordBatch* record_;
 };
 
 class Cvode {
@@ -146,7 +147,6 @@ class Cvode {
     int setup(N_Vector ypred, N_Vector fpred);
     int solvex_thread(neuron::model_sorted_token const&, double* b, double* y, NrnThread* nt);
     int solvex_thread_part1(double* b, NrnThread* nt);
-    int solvex_thread_part2(NrnThread* nt);
     int solvex_thread_part3(double* b, NrnThread* nt);
     void fun_thread(neuron::model_sorted_token const&,
                     double t,
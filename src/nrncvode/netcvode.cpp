@@ -39,11 +39,19 @@
 #include "utils/profile/profiler_interface.h"
 #include "utils/formatting.hpp"
 
+#include <algorithm>
 #include <array>
 #include <cerrno>
+#include <condition_variable>
 #include <cstdlib>
 #include <ctime>
+#include <deque>
+#include <filesystem>
+#include <memory>
+#include <mutex>
 #include <regex>
+#include <thread>
+#include <unordered_map>
 #include <unordered_set>
 #include <utility>
 
@@ -343,6 +351,9 @@ PlayRecordSave* PlayRecord::savestate_read(FILE* f) {
     case VecPlayContinuousType:
         prs = new VecPlayContinuousSave(plr);
         break;
+    case VecRecordStreamType:
+        prs = new VecRecordStreamSave(plr);
+        break;
     default:
         // whenever there is no subclass specific data to save
         prs = new PlayRecordSave(plr);
@@ -1127,6 +1138,7 @@ NetCvode::NetCvode(bool single) {
     fixed_play_->reserve(10);
     fixed_record_ = new std::vector<PlayRecord*>();
     fixed_record_->reserve(10);
+    fixed_record_batch_ = new std::vector<RecordBatch>();
     vec_event_store_ = nullptr;
     if (!record_init_items_) {
         record_init_items_ = new TQList();
@@ -1156,6 +1168,7 @@ NetCvode::~NetCvode() {
     delete std::exchange(pst_, nullptr);
     delete std::exchange(fixed_play_, nullptr);
     delete std::exchange(fixed_record_, nullptr);
+    delete std::exchange(fixed_record_batch_, nullptr);
     for (auto& item: *prl_) {
         delete item;
     }
@@ -5524,10 +5537,8 @@ void Cvode::check_deliver(NrnThread* nt) {
 void NetCvode::fixed_record_continuous(neuron::model_sorted_token const& cache_token,
                                        NrnThread& nt) {
     nrn_ba(cache_token, nt, BEFORE_STEP);
-    for (auto& pr: *fixed_record_) {
-        if (pr->ith_ == nt.id) {
-            pr->continuous(nt._t);
-        }
+    if (nt.id < fixed_record_batch_->size()) {
+        (*fixed_record_batch_)[nt.id].continuous(&cache_token, nt._t);
     }
 }
 
@@ -6027,6 +6038,11 @@ void NetCvode::playrec_remove(PlayRecord* pr) {  // called by PlayRecord destruc
     erase_first(*prl_, pr);
     erase_first(*fixed_play_, pr);
     erase_first(*fixed_record_, pr);
+    if (fixed_record_batch_) {
+        for (auto& batch: *fixed_record_batch_) {
+            batch.remove(pr);
+        }
+    }
 }
 
 int NetCvode::playrec_item(PlayRecord* pr) {
@@ -6161,6 +6177,65 @@ void YvecRecord::continuous(double tt) {
     y_->push_back(*pd_);
 }
 
+void RecordBatch::add(PlayRecord* pr) {
+    if (pr->type() == YvecRecordType) {
+        yvec_.push_back(static_cast<YvecRecord*>(pr));
+        cache_generation_ = 0;
+    } else if (pr->type() == TvecRecordType) {
+        tvec_.push_back(static_cast<TvecRecord*>(pr));
+    } else {
+        items_.push_back(pr);
+    }
+}
+
+// Called from ~PlayRecord, when pr->type() no longer gives the derived type,
+// so look for pr in every list.
+void RecordBatch::remove(PlayRecord* pr) {
+    auto const yit = std::find(yvec_.begin(), yvec_.end(), pr);
+    if (yit != yvec_.end()) {
+        yvec_.erase(yit);
+        cache_generation_ = 0;
+    }
+    auto const tit = std::find(tvec_.begin(), tvec_.end(), pr);
+    if (tit != tvec_.end()) {
+        tvec_.erase(tit);
+    }
+    erase_first(items_, pr);
+}
+
+void RecordBatch::clear() {
+    yvec_.clear();
+    tvec_.clear();
+    items_.clear();
+    cache_generation_ = 0;
+}
+
+void RecordBatch::continuous(neuron::model_sorted_token const* cache_token, double tt) {
+    if (cache_token) {
+        auto const generation = cache_token->cache().generation;
+        if (generation != cache_generation_) {
+            src_.resize(yvec_.size());
+            for (std::size_t i = 0; i < yvec_.size(); ++i) {
+                src_[i] = static_cast<double const*>(yvec_[i]->pd_);
+            }
+            cache_generation_ = generation;
+        }
+        for (std::size_t i = 0; i < yvec_.size(); ++i) {
+            yvec_[i]->y_->push_back(*src_[i]);
+        }
+    } else {
+        for (auto* yr: yvec_) {
+            yr->y_->push_back(*yr->pd_);
+        }
+    }
+    for (auto* tr: tvec_) {
+        tr->t_->push_back(tt);
+    }
+    for (auto* pr: items_) {
+        pr->continuous(tt);
+    }
+}
+
 VecRecordDiscrete::VecRecordDiscrete(neuron::container::data_handle<double> dh,
                                      IvocVect* y,
                                      IvocVect* t,
@@ -6292,6 +6367,406 @@ void VecRecordDt::deliver(double tt, NetCvode* nc) {
     e_->send(tt + dt_, nc, nrn_threads);
 }
 
+// A file written by one or more VecRecordStream. Apart from streams, which
+// only changes in the main thread, the fields are protected by the writer
+// mutex.
+struct RecordStreamFile {
+    std::string name;
+    FILE* f{};
+    size_t end{};                           // doubles in the file
+    size_t pending{};                       // chunks queued but not yet written
+    bool error{};                           // a write failed since the last wait
+    std::vector<VecRecordStream*> streams;  // recording to this file
+};
+
+namespace {
+// The chunk slots of the streams recorded by one thread. Slots are carved
+// out of a few large pages and taking one during a run does not lock, as
+// only that thread uses its buffer while a run is in progress.
+class RecordStreamBuffer {
+  public:
+    double* acquire() {
+        if (free_.empty()) {
+            size_t const n = VecRecordStream::chunk_size_;
+            pages_.emplace_back(new double[slots_per_page * n]);
+            for (size_t i = slots_per_page; i > 0; --i) {
+                free_.push_back(pages_.back().get() + (i - 1) * n);
+            }
+        }
+        double* const slot = free_.back();
+        free_.pop_back();
+        return slot;
+    }
+    void release(double* slot) {
+        free_.push_back(slot);
+    }
+
+  private:
+    static constexpr size_t slots_per_page = 16;
+    std::vector<std::unique_ptr<double[]>> pages_;
+    std::vector<double*> free_;
+};
+
+// by thread id, only resized in the main thread
+std::vector<RecordStreamBuffer> record_stream_buffers;
+
+// One background thread appends the full chunks of all VecRecordStream to
+// their files. Written chunks are recycled so that, after warm up, a handoff
+// does not allocate.
+struct RecordStreamWriter {
+    struct Item {
+        VecRecordStream* owner;
+        std::vector<double> data;
+    };
+
+    ~RecordStreamWriter() {
+        // values still sitting in partially filled slots at exit
+        for (auto* vrs: streams()) {
+            vrs->submit();
+        }
+        if (thread_.joinable()) {
+            {
+                std::lock_guard<std::mutex> lock{mut_};
+                stop_ = true;
+            }
+            cond_.notify_one();
+            thread_.join();
+        }
+        for (auto& [name, file]: files_) {
+            fflush(file->f);
+        }
+    }
+
+    // The file fname, shared with the streams already recording to it.
+    // nullptr if it cannot be opened.
+    RecordStreamFile* open(VecRecordStream* vrs, const char* fname) {
+        std::lock_guard<std::mutex> lock{mut_};
+        auto& file = files_[fname];
+        if (!file) {
+            FILE* f = fopen(fname, "wb");
+            if (!f) {
+                files_.erase(fname);
+                return nullptr;
+            }
+            file = std::make_unique<RecordStreamFile>();
+            file->name = fname;
+            file->f = f;
+        }
+        file->streams.push_back(vrs);
+        return file.get();
+    }
+
+    // The last stream of a file closes it. Call only when the file has no
+    // pending chunks.
+    void close(VecRecordStream* vrs) {
+        std::lock_guard<std::mutex> lock{mut_};
+        auto* file = vrs->file_;
+        erase_first(file->streams, vrs);
+        if (file->streams.empty()) {
+            fclose(file->f);
+            files_.erase(file->name);
+        }
+    }
+
+    std::vector<VecRecordStream*> streams() {
+        std::lock_guard<std::mutex> lock{mut_};
+        std::vector<VecRecordStream*> result;
+        for (auto& [name, file]: files_) {
+            result.insert(result.end(), file->streams.begin(), file->streams.end());
+        }
+        return result;
+    }
+
+    // Queue a copy of the n values at src.
+    void submit(VecRecordStream* vrs, double const* src, size_t n) {
+        std::lock_guard<std::mutex> lock{mut_};
+        std::vector<double> chunk;
+        if (!free_.empty()) {
+            chunk = std::move(free_.back());
+            free_.pop_back();
+        }
+        chunk.assign(src, src + n);
+        queue_.push_back({vrs, std::move(chunk)});
+        ++vrs->file_->pending;
+        if (!thread_.joinable()) {
+            thread_ = std::thread{&RecordStreamWriter::run, this};
+        }
+        cond_.notify_one();
+    }
+
+    // Wait until all chunks queued for file are written. Return false on
+    // write error.
+    bool wait(RecordStreamFile* file) {
+        std::unique_lock<std::mutex> lock{mut_};
+        done_cond_.wait(lock, [file] { return file->pending == 0; });
+        bool const ok = !file->error;
+        file->error = false;
+        return ok;
+    }
+
+  private:
+    void run() {
+        std::unique_lock<std::mutex> lock{mut_};
+        for (;;) {
+            cond_.wait(lock, [this] { return stop_ || !queue_.empty(); });
+            if (queue_.empty()) {
+                return;
+            }
+            Item item = std::move(queue_.front());
+            queue_.pop_front();
+            auto* const file = item.owner->file_;
+            size_t const n = item.data.size();
+            size_t const offset = file->end;
+            lock.unlock();
+            bool const ok = fwrite(item.data.data(), sizeof(double), n, file->f) == n;
+            lock.lock();
+            if (ok) {
+                file->end += n;
+                auto& extents = item.owner->extents_;
+                if (!extents.empty() && extents.back().first + extents.back().second == offset) {
+                    extents.back().second += n;
+                } else {
+                    extents.emplace_back(offset, n);
+                }
+            } else {
+                file->error = true;
+            }
+            --file->pending;
+            free_.push_back(std::move(item.data));
+            done_cond_.notify_all();
+        }
+    }
+
+    std::mutex mut_;
+    std::condition_variable cond_;       // work available or stop
+    std::condition_variable done_cond_;  // a chunk was written
+    std::deque<Item> queue_;
+    std::vector<std::vector<double>> free_;
+    std::unordered_map<std::string, std::unique_ptr<RecordStreamFile>> files_;
+    std::thread thread_;
+    bool stop_{false};
+};
+
+RecordStreamWriter& record_stream_writer() {
+    static RecordStreamWriter writer;
+    return writer;
+}
+}  // namespace
+
+size_t VecRecordStream::chunk_size_ = 1 << 13;
+
+// CVode.record_chunk(n). Slots of the old size are given back first.
+void VecRecordStream::set_chunk_size(size_t n) {
+    for (auto* vrs: record_stream_writer().streams()) {
+        vrs->release_slot();
+    }
+    auto const nbuf = record_stream_buffers.size();
+    record_stream_buffers.clear();
+    record_stream_buffers.resize(nbuf);
+    chunk_size_ = n;
+}
+
+size_t nrn_record_stream_chunk(size_t n) {
+    if (n) {
+        VecRecordStream::set_chunk_size(n);
+    }
+    return VecRecordStream::chunk_size_;
+}
+
+VecRecordStream::VecRecordStream(neuron::container::data_handle<double> pd,
+                                 IvocVect* y,
+                                 double dt,
+                                 const char* fname,
+                                 Object* ppobj)
+    : PlayRecord(std::move(pd), ppobj) {
+    // printf("VecRecordStream\n");
+    y_ = y;
+    dt_ = dt;
+    ObjObservable::Attach(y_->obj_, this);
+    e_ = new PlayRecordEvent();
+    e_->plr_ = this;
+    slot_ = nullptr;
+    slot_ith_ = 0;
+    nslot_ = 0;
+    cap_ = 0;
+    count_ = 0;
+    file_ = record_stream_writer().open(this, fname);
+}
+
+VecRecordStream::~VecRecordStream() {
+    // printf("~VecRecordStream\n");
+    if (file_) {
+        release_slot();
+        record_stream_writer().wait(file_);
+        record_stream_writer().close(this);
+    }
+    ObjObservable::Detach(y_->obj_, this);
+    delete e_;
+}
+
+PlayRecordSave* VecRecordStream::savestate_save() {
+    return new VecRecordStreamSave(this);
+}
+
+VecRecordStreamSave::VecRecordStreamSave(PlayRecord* prl)
+    : PlayRecordSave(prl) {
+    count_ = ((VecRecordStream*) pr_)->count();
+}
+VecRecordStreamSave::~VecRecordStreamSave() {}
+void VecRecordStreamSave::savestate_restore() {
+    check();
+    ((VecRecordStream*) pr_)->truncate(count_);
+}
+void VecRecordStreamSave::savestate_write(FILE* f) {
+    fprintf(f, "%zu\n", count_);
+}
+void VecRecordStreamSave::savestate_read(FILE* f) {
+    char buf[100];
+    nrn_assert(fgets(buf, 100, f));
+    nrn_assert(sscanf(buf, "%zu\n", &count_) == 1);
+}
+
+void VecRecordStream::disconnect(Observable*) {
+    //	printf("%s VecRecordStream disconnect\n", hoc_object_name(y_->obj_));
+    delete this;
+}
+
+void VecRecordStream::install(Cvode* cv) {
+    record_add(cv);
+}
+
+void VecRecordStream::record_init() {
+    if (!file_) {
+        hoc_execerror("Vector.record: no file for", hoc_object_name(y_->obj_));
+    }
+    if (record_stream_buffers.size() < size_t(nrn_nthread)) {
+        record_stream_buffers.resize(nrn_nthread);
+    }
+    // the thread that records may have changed
+    release_slot();
+    truncate(0);
+    y_->resize(0);
+    if (dt_ > 0.) {
+        e_->send(nrn_threads->_t, net_cvode_instance, nrn_threads);
+    }
+}
+
+void VecRecordStream::frecord_init(TQItem* q) {
+    record_init_items_->push_back(q);
+}
+
+void VecRecordStream::continuous(double tt) {
+    if (dt_ <= 0.) {
+        auto* const ptr = static_cast<double*>(pd_);
+        push(ptr == &t ? tt : *ptr, ith_);
+    }
+}
+
+void VecRecordStream::deliver(double tt, NetCvode* nc) {
+    auto* const ptr = static_cast<double*>(pd_);
+    push(ptr == &t ? tt : *ptr, 0);
+    e_->send(tt + dt_, nc, nrn_threads);
+}
+
+void VecRecordStream::next_slot(int ith) {
+    submit();
+    if (!slot_) {
+        slot_ = record_stream_buffers[ith].acquire();
+        slot_ith_ = ith;
+    }
+    cap_ = chunk_size_;
+}
+
+void VecRecordStream::submit() {
+    if (nslot_) {
+        count_ += nslot_;
+        record_stream_writer().submit(this, slot_, nslot_);
+        nslot_ = 0;
+    }
+}
+
+void VecRecordStream::release_slot() {
+    submit();
+    if (slot_) {
+        record_stream_buffers[slot_ith_].release(slot_);
+        slot_ = nullptr;
+    }
+    cap_ = 0;
+}
+
+void VecRecordStream::flush() {
+    submit();
+    bool const ok = record_stream_writer().wait(file_);
+    if (!ok || fflush(file_->f) != 0) {
+        hoc_execerror("Vector.record: error writing", file_->name.c_str());
+    }
+}
+
+void VecRecordStream::truncate(size_t size) {
+    flush();
+    if (size < count_) {
+        size_t n = 0;
+        auto it = extents_.begin();
+        for (; it != extents_.end() && n + it->second <= size; ++it) {
+            n += it->second;
+        }
+        if (it != extents_.end() && n < size) {
+            it->second = size - n;
+            ++it;
+        }
+        extents_.erase(it, extents_.end());
+        count_ = size;
+        // give back the end of the file if no stream has values there
+        size_t end = 0;
+        for (auto* vrs: file_->streams) {
+            if (!vrs->extents_.empty()) {
+                end = std::max(end, vrs->extents_.back().first + vrs->extents_.back().second);
+            }
+        }
+        if (end < file_->end) {
+            std::error_code err;
+            std::filesystem::resize_file(file_->name, end * sizeof(double), err);
+            if (err) {
+                hoc_execerror("Vector.record: could not truncate", file_->name.c_str());
+            }
+            file_->end = end;
+        }
+    }
+    fseek(file_->f, long(file_->end * sizeof(double)), SEEK_SET);
+}
+
+void VecRecordStream::load(IvocVect* dest, size_t start, size_t n) {
+    flush();
+    start = std::min(start, count_);
+    n = std::min(n, count_ - start);
+    dest->resize(n);
+    if (n == 0) {
+        return;
+    }
+    FILE* f = fopen(file_->name.c_str(), "rb");
+    if (!f) {
+        hoc_execerror("Vector.record_load: could not open", file_->name.c_str());
+    }
+    bool ok = true;
+    double* out = dest->data();
+    for (auto it = extents_.begin(); ok && n > 0 && it != extents_.end(); ++it) {
+        if (start >= it->second) {
+            start -= it->second;
+            continue;
+        }
+        size_t const k = std::min(n, it->second - start);
+        ok = fseek(f, long((it->first + start) * sizeof(double)), SEEK_SET) == 0 &&
+             fread(out, sizeof(double), k, f) == k;
+        out += k;
+        n -= k;
+        start = 0;
+    }
+    fclose(f);
+    if (!ok) {
+        hoc_execerror("Vector.record_load: error reading", file_->name.c_str());
+    }
+}
+
 void NetCvode::vecrecord_add() {
     auto const pd = hoc_hgetarg<double>(1);
     consist_sec_pd("Cvode.record", chk_access(), pd);
@@ -6372,6 +6847,10 @@ void NetCvode::playrec_setup() {
         // Destructor should de-register things
         delete pr;
     }
+    fixed_record_batch_->assign(nrn_nthread, RecordBatch{});
+    for (auto* pr: *fixed_record_) {
+        (*fixed_record_batch_)[pr->ith_].add(pr);
+    }
     playrec_change_cnt_ = structure_change_cnt_;
 }
 
@@ -22,6 +22,7 @@ class SelfEvent;
 using SelfEventPool = MutexPool<SelfEvent>;
 struct hoc_Item;
 class PlayRecord;
+class RecordBatch;
 class IvocVect;
 struct BAMechList;
 class HTList;
@@ -128,6 +129,7 @@ class NetCvode {
     // fixed step continuous play and record
     std::vector<PlayRecord*>* fixed_play_;
     std::vector<PlayRecord*>* fixed_record_;
+    std::vector<RecordBatch>* fixed_record_batch_;  // fixed_record_ by thread
     void vecrecord_add();  // hoc interface functions
     void vec_remove();
     void record_init();
@@ -28,7 +28,6 @@ extern void (*nrnmpi_v_transfer_)();
 
 extern void (*nrn_multisplit_setup_)();
 extern void* nrn_multisplit_triang(NrnThread*);
-extern void* nrn_multisplit_reduce_solve(NrnThread*);
 extern void* nrn_multisplit_bksub(NrnThread*);
 extern void nrn_multisplit_nocap_v();
 extern void nrn_multisplit_nocap_v_part1(NrnThread*);
@@ -674,10 +673,6 @@ int Cvode::solvex_thread_part1(double* b, NrnThread* nt) {
     nrn_multisplit_triang(nt);
     return 0;
 }
-int Cvode::solvex_thread_part2(NrnThread* nt) {
-    nrn_multisplit_reduce_solve(nt);
-    return 0;
-}
 int Cvode::solvex_thread_part3(double* b, NrnThread* nt) {
     nrn_multisplit_bksub(nt);
     // for (i=0; i < v_node_count; ++i) {
@@ -1092,10 +1087,9 @@ void Cvode::delete_prl() {
 void Cvode::record_add(PlayRecord* pr) {
     CvodeThreadData& z = CTD(pr->ith_);
     if (!z.record_) {
-        z.record_ = new std::vector<PlayRecord*>();
-        z.record_->reserve(1);
+        z.record_ = new RecordBatch();
     }
-    z.record_->push_back(pr);
+    z.record_->add(pr);
 }
 
 void Cvode::record_continuous() {
@@ -1110,9 +1104,7 @@ void Cvode::record_continuous() {
                 before_after(sorted_token, z.before_step_, nt);
             }
             if (z.record_) {
-                for (auto& item: *(z.record_)) {
-                    item->continuous(t_);
-                }
+                z.record_->continuous(&sorted_token, t_);
             }
         }
     }
@@ -1124,9 +1116,7 @@ void Cvode::record_continuous_thread(NrnThread* nt) {
         before_after(nrn_ensure_model_data_are_sorted(), z.before_step_, nt);
     }
     if (z.record_) {
-        for (auto& item: *(z.record_)) {
-            item->continuous(t_);
-        }
+        z.record_->continuous(nullptr, t_);
     }
 }
 
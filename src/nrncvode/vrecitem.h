@@ -4,6 +4,11 @@
 #include <netcon.h>
 #include <ivocvect.h>
 
+#include <cstdio>
+#include <string>
+#include <utility>
+#include <vector>
+
 class PlayRecord;
 class PlayRecordSave;
 class VecRecordDiscreteSave;
@@ -12,6 +17,9 @@ class VecPlayContinuousSave;
 class StmtInfo;
 struct NrnThread;
 struct Section;
+namespace neuron {
+struct model_sorted_token;
+}
 
 // SaveState subtypes for PlayRecordType and trajectory return type
 #define VecRecordDiscreteType 1
@@ -22,6 +30,7 @@ struct Section;
 #define YvecRecordType        6
 #define GLineRecordType       7
 #define GVectorRecordType     8
+#define VecRecordStreamType   9
 
 // used by PlayRecord subclasses that utilize discrete events
 class PlayRecordEvent: public DiscreteEvent {
@@ -145,6 +154,27 @@ class YvecRecord: public PlayRecord {
     IvocVect* y_;
 };
 
+// The record items of one thread (fixed step) or one CvodeThreadData.
+// YvecRecord and TvecRecord, by far the most common items, are not called
+// through PlayRecord::continuous every step. Instead a flat loop reads
+// through raw pointers that are refreshed whenever the model data cache is
+// rebuilt. Any other items are called as usual.
+class RecordBatch {
+  public:
+    void add(PlayRecord*);
+    void remove(PlayRecord*);
+    void clear();
+    // Without a cache_token the YvecRecord values are read through pd_.
+    void continuous(neuron::model_sorted_token const* cache_token, double t);
+
+  private:
+    std::vector<YvecRecord*> yvec_;
+    std::vector<TvecRecord*> tvec_;
+    std::vector<PlayRecord*> items_;
+    std::vector<double const*> src_;  // raw yvec_[i]->pd_
+    std::size_t cache_generation_{};  // of src_, 0 means stale
+};
+
 class VecRecordDiscrete: public PlayRecord {
   public:
     VecRecordDiscrete(neuron::container::data_handle<double>,
@@ -223,6 +253,92 @@ class VecRecordDtSave: public PlayRecordSave {
     virtual void savestate_restore();
 };
 
+// Vector.record(&var, [Dt,] "filename")
+// Instead of growing the Vector, recorded values are collected into chunk
+// slots handed out from a buffer of the recording thread. A background
+// thread appends each full chunk to the file as native doubles. Streams
+// naming the same file share it, their chunks are then interleaved and
+// extents_ tells where the values of each stream are. Only a chunk handoff
+// synchronizes with the writer, push() does not lock.
+// Vector.record_load(...) copies (part of) the values back into the Vector.
+struct RecordStreamFile;
+
+class VecRecordStream: public PlayRecord {
+  public:
+    VecRecordStream(neuron::container::data_handle<double>,
+                    IvocVect* y,
+                    double dt,
+                    const char* fname,
+                    Object* ppobj = nullptr);
+    virtual ~VecRecordStream();
+    virtual void install(Cvode*);
+    virtual void record_init();
+    virtual void continuous(double t);
+    virtual void deliver(double t, NetCvode*);
+    virtual PlayRecordEvent* event() {
+        return e_;
+    }
+
+    virtual void disconnect(Observable*);
+    virtual bool uses(void* v) {
+        return (void*) y_ == v;
+    }
+
+    virtual void frecord_init(TQItem*);
+    virtual int type() {
+        return VecRecordStreamType;
+    }
+    virtual PlayRecordSave* savestate_save();
+
+    // ith is the thread that records, the slot comes from its buffer
+    void push(double x, int ith) {
+        if (nslot_ == cap_) {
+            next_slot(ith);
+        }
+        slot_[nslot_++] = x;
+    }
+    bool is_open() const {
+        return file_ != nullptr;
+    }
+    void submit();               // hand the values in the slot to the writer thread
+    void release_slot();         // submit and give the slot back to its thread
+    void flush();                // return when everything pushed is in the file
+    void truncate(size_t size);  // discard values beyond size
+    void load(IvocVect* dest, size_t start, size_t n);
+    size_t count() const {
+        return count_ + nslot_;
+    }
+
+    IvocVect* y_;
+    double dt_;  // <= 0 means every time step
+    PlayRecordEvent* e_;
+    RecordStreamFile* file_;
+    double* slot_;   // chunk_size_ values, nullptr until the first push
+    int slot_ith_;   // thread whose buffer slot_ belongs to
+    size_t nslot_;   // values in slot_
+    size_t cap_;     // chunk_size_ once there is a slot, else 0
+    size_t count_;   // values handed to the writer
+    // (offset, count) in doubles of the written values, in order. Appended
+    // by the writer thread, read once the file has no pending chunks.
+    std::vector<std::pair<size_t, size_t>> extents_;
+
+    static size_t chunk_size_;  // values per chunk, default 1 << 13
+    static void set_chunk_size(size_t n);
+
+  private:
+    void next_slot(int ith);
+};
+
+class VecRecordStreamSave: public PlayRecordSave {
+  public:
+    VecRecordStreamSave(PlayRecord*);
+    virtual ~VecRecordStreamSave();
+    virtual void savestate_restore();
+    virtual void savestate_write(FILE*);
+    virtual void savestate_read(FILE*);
+    size_t count_;
+};
+
 class VecPlayStep: public PlayRecord {
   public:
     VecPlayStep(neuron::container::data_handle<double>,
@@ -80,12 +80,12 @@ void GLineRecord::fill_pd1() {
             rangevarevalpointer();
             pd = hoc_pxpop();
             hoc_pushx(*pd);
-        } else if (pc1->pf == hoc_varpush) {
+        } else if (pc1->pf == hoc_varpush || pc1->pf == hoc_varpush_eval) {
             Symbol* sym = hoc_pc->sym;
             if (strcmp(sym->name, "t") == 0) {
                 saw_t_ = true;
             }
-            hoc_varpush();
+            (*((pc1)->pf))();
         } else {
             (*((pc1)->pf))();
         }
@@ -958,11 +958,9 @@ void KSChan::setname(const char* s) {
         }
         Sprintf(old_suffix, "_%s", mechsym_->name);
         const char* suffix = name_.c_str();
-        free(mechsym_->name);
-        mechsym_->name = strdup(suffix);
+        hoc_symbol_rename(mechsym_, suffix);
         if (is_point()) {
-            free(rlsym_->name);
-            rlsym_->name = strdup(suffix);
+            hoc_symbol_rename(rlsym_, suffix);
         }
 
         Symbol* sp;
@@ -978,8 +976,8 @@ void KSChan::setname(const char* s) {
                     strncpy(s1, sp->name, nbase);
                     std::snprintf(s1 + nbase, n - nbase, "_%s", suffix);
                     // printf("KSChan::setname change %s to %s\n", sp->name, s1);
-                    free(sp->name);
-                    sp->name = s1;
+                    hoc_symbol_rename(sp, s1);
+                    free(s1);
                 }
             }
         }
@@ -2053,8 +2051,7 @@ void KSChan::sname_install() {
             Sprintf(buf1, "%s%d", state_[i].string(), j++);
             nrn_assert(snprintf(buf, 100, "%s%s", buf1, unsuffix) < 100);
         }
-        free(snew[i + soffset_]->name);
-        snew[i + soffset_]->name = strdup(buf);
+        hoc_symbol_rename(snew[i + soffset_], buf);
         if (strlen(buf1) > 0) {
             state_[i].name_ = buf1;
         }
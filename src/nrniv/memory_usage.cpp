@@ -27,12 +27,9 @@ cache::ModelMemoryUsage memory_usage(const neuron::cache::Model& model) {
 
     VectorMemoryUsage mechanism(model.mechanism);
     for (const auto& m: model.mechanism) {
-        mechanism += VectorMemoryUsage(m.pdata_ptr_cache);
-
-        mechanism += VectorMemoryUsage(m.pdata);
-        for (const auto& pd: m.pdata) {
-            mechanism += VectorMemoryUsage(pd);
-        }
+        mechanism += VectorMemoryUsage(m.pdata_base);
+        mechanism += VectorMemoryUsage(m.pdata_index_ptr);
+        mechanism += VectorMemoryUsage(m.pdata_index);
 
         mechanism += VectorMemoryUsage(m.pdata_hack);
         for (const auto& pdd: m.pdata_hack) {
@@ -21,13 +21,14 @@ int nrn_multisplit_active_;
 
 extern void (*nrn_multisplit_setup_)();
 extern void* nrn_multisplit_triang(NrnThread*);
-extern void* nrn_multisplit_reduce_solve(NrnThread*);
+void nrn_multisplit_reduce_solve();
 extern void* nrn_multisplit_bksub(NrnThread*);
 extern double t;
 
 extern void (*nrn_multisplit_solve_)();
 static void multisplit_v_setup();
 static void multisplit_solve();
+static void* multisplit_rtree_solve(NrnThread*);
 
 extern double nrnmpi_rtcomp_time_;
 #if NRNMPI
@@ -41,9 +42,11 @@ static double nrnmpi_splitcell_wait_;
 static int nrnmpi_use;
 static void nrnmpi_int_allgather(int*, int*, int) {}
 static void nrnmpi_int_allgatherv(int*, int*, int*, int*) {}
-static void nrnmpi_postrecv_doubles(double*, int, int, int, void**) {}
-static void nrnmpi_send_doubles(double*, int, int, int) {}
 static void nrnmpi_wait(void**) {}
+static void nrnmpi_send_init_doubles(double*, int, int, int, void**) {}
+static void nrnmpi_recv_init_doubles(double*, int, int, int, void**) {}
+static void nrnmpi_start(void**) {}
+static void nrnmpi_request_free(void**) {}
 static void nrnmpi_barrier() {}
 static double nrnmpi_wtime() {
     return 0.0;
@@ -286,7 +289,8 @@ struct MultiSplitTransferInfo {
     int* ioffdiag_;        // indices of above, to recalculate offdiag when freed
     int size_;             // 2*nnode_ + nnode_rt_ doubles needed in buffer
     int displ_;            // displacement into trecvbuf_
-    void* request_;        // MPI_Request
+    void* request_{};      // persistent MPI_Request receiving into trecvbuf_
+    void* send_request_{};  // persistent MPI_Request sending from tsendbuf_
     int tag_;              // short<->long, long<->long, subtree->rthost, rthost->subtree
     int rthost_;           // host id where the reduced tree is located (normally -1)
 };
@@ -325,6 +329,8 @@ MultiSplitControl::MultiSplitControl() {
 
     nrtree_ = 0;
     rtree_ = 0;
+    nexchange_ = 0;
+    wait_long_time_ = rtree_time_ = wait_result_time_ = 0.0;
 
 
     multisplit_list_ = 0;
@@ -449,6 +455,12 @@ void MultiSplitControl::del_msti() {
     }
     if (msti_) {
         for (i = 0; i < nthost_; ++i) {
+            if (msti_[i].request_) {
+                nrnmpi_request_free(&msti_[i].request_);
+            }
+            if (msti_[i].send_request_) {
+                nrnmpi_request_free(&msti_[i].send_request_);
+            }
             if (msti_[i].nnode_rt_) {
                 delete[] msti_[i].nd_rt_index_;
                 delete[] msti_[i].nd_rt_index_th_;
@@ -1599,6 +1611,29 @@ ab.ibuf[0], ab.ibuf[1], (ab.n == 3) ? ab.ibuf[2] : -1);
         }
     }
 
+    // Every time step sends and receives the same buffers with the same
+    // hosts and tags, so the requests are created once. Each host gets one
+    // message, either long backbone info before the reduced tree solve or
+    // the reduced tree and short backbone results after it.
+    for (i = 0; i < nthost_; ++i) {
+        MultiSplitTransferInfo& mt = msti_[i];
+        int tag = mt.tag_;
+        // receiving the result from a reduced tree is tag 4.
+        if (tag == 3 && nrnmpi_myid != mt.rthost_) {
+            tag = 4;
+        }
+        nrnmpi_recv_init_doubles(trecvbuf_ + mt.displ_, mt.size_, mt.host_, tag, &mt.request_);
+        tag = mt.tag_;
+        // sending result from reduced tree means tag is 4
+        if (tag == 3 && i >= ihost_reduced_long_) {
+            tag = 4;
+        }
+        nrnmpi_send_init_doubles(
+            tsendbuf_ + mt.displ_, mt.size_, mt.host_, tag, &mt.send_request_);
+    }
+    nexchange_ = 0;
+    wait_long_time_ = rtree_time_ = wait_result_time_ = 0.0;
+
     // printf("%d leave exchange_setup\n", nrnmpi_myid);
     // nrnmpi_int_allgather(&n, nn, 1);
 
@@ -1889,6 +1924,13 @@ void MultiSplitControl::prstruct() {
                    tbsize,
                    fmt::ptr(trecvbuf_),
                    fmt::ptr(tsendbuf_));
+            Printf(" matrix_exchange %d  wait long backbone %g  ReducedTree solve %g (%d threads)"
+                   "  wait result %g\n",
+                   nexchange_,
+                   wait_long_time_,
+                   rtree_time_,
+                   (nrn_nthread > 1 && nrtree_ > 1) ? nrn_nthread : 1,
+                   wait_result_time_);
             Printf("\n");
         }
     }
@@ -1911,10 +1953,20 @@ void* nrn_multisplit_triang(NrnThread* nt) {
     msc_->mth_[nt->id].triang(nt);
     return nullptr;
 }
-void* nrn_multisplit_reduce_solve(NrnThread* nt) {
-    if (nt->id == 0) {
-        msc_->reduce_solve();
+// Called by the main thread between the triang and bksub thread jobs.
+// The reduced trees are independent so all the threads share them while
+// the main thread alone does the exchange on either side.
+void nrn_multisplit_reduce_solve() {
+    msc_->matrix_exchange_begin();
+    if (nrn_nthread > 1 && msc_->nrtree_ > 1) {
+        nrn_multithread_job(multisplit_rtree_solve);
+    } else {
+        msc_->rtree_solve(0, 1);
     }
+    msc_->matrix_exchange_end();
+}
+static void* multisplit_rtree_solve(NrnThread* nt) {
+    msc_->rtree_solve(nt->id, nrn_nthread);
     return nullptr;
 }
 void* nrn_multisplit_bksub(NrnThread* nt) {
@@ -1946,8 +1998,10 @@ void MultiSplitThread::triang(NrnThread* _nt) {
     triang_subtree2backbone(_nt);
     triang_backbone(_nt);
 }
-void MultiSplitControl::reduce_solve() {
-    matrix_exchange();
+void MultiSplitControl::rtree_solve(int ith, int nth) {
+    for (int i = ith; i < nrtree_; i += nth) {
+        rtree_[i]->solve();
+    }
 }
 void MultiSplitThread::bksub(NrnThread* _nt) {
     bksub_backbone(_nt);
@@ -2094,29 +2148,31 @@ void MultiSplitControl::multisplit_adjust_rhs(NrnThread* _nt) {
 // short -> long  ihost_short_long, nthost_
 
 void MultiSplitControl::matrix_exchange() {
+    matrix_exchange_begin();
+    rtree_solve(0, 1);
+    matrix_exchange_end();
+}
+
+// Everything up to the ReducedTree solve. The requests are the persistent
+// ones made by exchange_setup and each message is the packed tsendbuf_
+// segment for one host.
+void MultiSplitControl::matrix_exchange_begin() {
     int i, j, jj, k;
     double* tbuf;
-    double rttime;
-    double wt = nrnmpi_wtime();
     NrnThread* _nt;
+    exchange_start_ = nrnmpi_wtime();
     // the mpi strategy is copied from the
     // cvode/examples_par/pvkxb.cpp exchange strategy
 
 #define EXCHANGE_ON 1
 #if EXCHANGE_ON
-    // post all the receives
+    // start all the receives
     for (i = 0; i < nthost_; ++i) {
-        int tag;
         MultiSplitTransferInfo& mt = msti_[i];
-        tag = mt.tag_;
-        // receiving the result from a reduced tree is tag 4.
-        if (tag == 3 && nrnmpi_myid != mt.rthost_) {
-            tag = 4;
-        }
-        nrnmpi_postrecv_doubles(trecvbuf_ + mt.displ_, mt.size_, mt.host_, tag, &mt.request_);
+        nrnmpi_start(&mt.request_);
 #if 0
-printf("%d post receive %d displ=%d size=%d host=%d tag=%d\n",
-nrnmpi_myid, i, mt.displ_, mt.size_, mt.host_, tag);
+printf("%d post receive %d displ=%d size=%d host=%d\n",
+nrnmpi_myid, i, mt.displ_, mt.size_, mt.host_);
 #endif
     }
 
@@ -2177,8 +2233,7 @@ i, j, ab.inode, ab.ibuf[j], tbuf[ab.ibuf[j]]);
     // send long backbone info (long->short, long->long)
     for (i = 0; i < ihost_reduced_long_; ++i) {
         MultiSplitTransferInfo& mt = msti_[i];
-        tbuf = tsendbuf_ + mt.displ_;
-        nrnmpi_send_doubles(tbuf, mt.size_, mt.host_, mt.tag_);
+        nrnmpi_start(&mt.send_request_);
 #if 0
 printf("%d post send %d displ=%d size=%d host=%d tag=%d\n",
 nrnmpi_myid, i, mt.displ_, mt.size_, mt.host_, mt.tag_);
@@ -2212,7 +2267,8 @@ for (i=0; i < tbsize_; ++i) { printf("%d trecvbuf[%d] = %g\n", nrnmpi_myid, i, t
 #endif
 
     // measure reducedtree,short backbone computation time
-    rttime = nrnmpi_wtime();
+    rtree_start_ = nrnmpi_wtime();
+    wait_long_time_ += rtree_start_ - exchange_start_;
 
     // adjust area in place for any D, RHS, sid1A, sid1B on this host
     // going to ReducedTree on this host
@@ -2226,28 +2282,25 @@ for (i=0; i < tbsize_; ++i) { printf("%d trecvbuf[%d] = %g\n", nrnmpi_myid, i, t
         }
     }
 #endif  // EXCHANGE_ON
+}
 
-    for (i = 0; i < nrtree_; ++i) {
-        rtree_[i]->solve();
-    }
-
-#if EXCHANGE_ON
+// Everything after the ReducedTree solve.
+void MultiSplitControl::matrix_exchange_end() {
+    int i, j, jj, k;
+    double* tbuf;
+    NrnThread* _nt;
     // measure reducedtree,short backbone computation time
-    nrnmpi_rtcomp_time_ += nrnmpi_wtime() - rttime;
+    double wt = nrnmpi_wtime();
+    rtree_time_ += wt - rtree_start_;
+    nrnmpi_rtcomp_time_ += wt - rtree_start_;
 
+#if EXCHANGE_ON
     // send reduced and short backbone info (reduced -> long, short -> long)
     for (i = ihost_reduced_long_; i < nthost_; ++i) {
-        int tag;
         MultiSplitTransferInfo& mt = msti_[i];
-        tbuf = tsendbuf_ + mt.displ_;
         // printf("%d send result to %d size=%d tag=%d\n", nrnmpi_myid, mt.host_, mt.size_,
         // mt.tag_);
-        tag = mt.tag_;
-        // sending result from reduced tree means tag is 4
-        if (tag == 3) {
-            tag = 4;
-        }
-        nrnmpi_send_doubles(tbuf, mt.size_, mt.host_, tag);
+        nrnmpi_start(&mt.send_request_);
         // only moderately wasteful (50%) in sending back irrelevant
         // off diag info. Required is only 2*mt.nnode_. But these
         // messages are pretty short, anyway.
@@ -2296,10 +2349,18 @@ nrnmpi_myid, mt.host_, 2*j, tbuf[2*j], 2*j+1, tbuf[2*j+1], mt.nodeindex_[j]);
 }
 #endif
     }
+
+    // the send buffers may not change until the sends complete
+    for (i = 0; i < nthost_; ++i) {
+        nrnmpi_wait(&msti_[i].send_request_);
+    }
 #endif  // EXCHANGE_ON
 
+    double now = nrnmpi_wtime();
+    wait_result_time_ += now - wt;
+    ++nexchange_;
 #if NRNMPI
-    nrnmpi_splitcell_wait_ += nrnmpi_wtime() - wt;
+    nrnmpi_splitcell_wait_ += now - exchange_start_;
 #endif
     errno = 0;
 }
@@ -2315,19 +2376,13 @@ void MultiSplitControl::matrix_exchange_nocap() {  // copy of matrix_exchange()
 
 #define EXCHANGE_ON 1
 #if EXCHANGE_ON
-    // post all the receives
+    // start all the receives
     for (i = 0; i < nthost_; ++i) {
-        int tag;
         MultiSplitTransferInfo& mt = msti_[i];
-        tag = mt.tag_;
-        // receiving the result from a reduced tree is tag 4.
-        if (tag == 3 && nrnmpi_myid != mt.rthost_) {
-            tag = 4;
-        }
-        nrnmpi_postrecv_doubles(trecvbuf_ + mt.displ_, mt.size_, mt.host_, tag, &mt.request_);
+        nrnmpi_start(&mt.request_);
 #if 0
-printf("%d post receive %d displ=%d size=%d host=%d tag=%d\n",
-nrnmpi_myid, i, mt.displ_, mt.size_, mt.host_, tag);
+printf("%d post receive %d displ=%d size=%d host=%d\n",
+nrnmpi_myid, i, mt.displ_, mt.size_, mt.host_);
 #endif
     }
 
@@ -2371,8 +2426,7 @@ nrnmpi_myid, mt.host_, jj, tbuf[jj]);
     // send long backbone info (long->short, long->long)
     for (i = 0; i < ihost_reduced_long_; ++i) {
         MultiSplitTransferInfo& mt = msti_[i];
-        tbuf = tsendbuf_ + mt.displ_;
-        nrnmpi_send_doubles(tbuf, mt.size_, mt.host_, mt.tag_);
+        nrnmpi_start(&mt.send_request_);
 #if 0
 printf("%d post send %d displ=%d size=%d host=%d tag=%d\n",
 nrnmpi_myid, i, mt.displ_, mt.size_, mt.host_, mt.tag_);
@@ -2441,17 +2495,10 @@ nrnmpi_myid, mt.host_, 2*j, tbuf[2*j], 2*j+1, tbuf[2*j+1], mt.nodeindex_[j]);
 
     // send reduced and short backbone info (reduced -> long, short -> long)
     for (i = ihost_reduced_long_; i < nthost_; ++i) {
-        int tag;
         MultiSplitTransferInfo& mt = msti_[i];
-        tbuf = tsendbuf_ + mt.displ_;
         // printf("%d send result to %d size=%d tag=%d\n", nrnmpi_myid, mt.host_, mt.size_,
         // mt.tag_);
-        tag = mt.tag_;
-        // sending result from reduced tree means tag is 4
-        if (tag == 3) {
-            tag = 4;
-        }
-        nrnmpi_send_doubles(tbuf, mt.size_, mt.host_, tag);
+        nrnmpi_start(&mt.send_request_);
         // only moderately wasteful (50%) in sending back irrelevant
         // off diag info. Required is only 2*mt.nnode_. But these
         // messages are pretty short, anyway.
@@ -2495,6 +2542,11 @@ nrnmpi_myid, mt.host_, 2*j, tbuf[2*j], 2*j+1, tbuf[2*j+1], mt.nodeindex_[j]);
 }
 #endif
     }
+
+    // the send buffers may not change until the sends complete
+    for (i = 0; i < nthost_; ++i) {
+        nrnmpi_wait(&msti_[i].send_request_);
+    }
 #endif  // EXCHANGE_ON
 
 #if NRNMPI
@@ -39,12 +39,14 @@ class MultiSplitControl {
     void multisplit_nocap_v_part3(NrnThread*);
     void multisplit_adjust_rhs(NrnThread*);
     void prstruct();
-    void reduce_solve();
+    void rtree_solve(int ith, int nth);
 
     void multisplit(Section*, double, int, int);
     void solve();
     void reduced_mark(int, int, int, int*, int*, int*);
     void matrix_exchange();
+    void matrix_exchange_begin();
+    void matrix_exchange_end();
     void matrix_exchange_nocap();
     void v_setup();
     void exchange_setup();
@@ -77,6 +79,13 @@ class MultiSplitControl {
     int nrtree_;
     ReducedTree** rtree_;
 
+    // matrix_exchange timing (s), printed by prstruct
+    int nexchange_;
+    double exchange_start_, rtree_start_;
+    double wait_long_time_;    // pack, send, and wait for the long backbone info
+    double rtree_time_;        // ReducedTree solve
+    double wait_result_time_;  // send and wait for the ReducedTree and short backbone results
+
     std::unique_ptr<MultiSplitTable> classical_root_to_multisplit_;
     MultiSplitList* multisplit_list_;  // NrnHashIterate is not in insertion order
 
@@ -3,14 +3,19 @@
 #include "../../nrnconf.h"
 #include "hocdec.h"
 #include "cabcode.h"
+#include "nrn_ansi.h"
 #include "nrniv_mf.h"
 #include "nrnmpi.h"
 #include "nrnmpiuse.h"
 #include "ocfunc.h"
 #include "ocjump.h"
 #include "parse.hpp"
+#include "range_column.hpp"
 #include "section.h"
 #include "shapeplt.h"
+#include "neuron/model_data.hpp"
+
+#include <vector>
 
 /// A public face of hoc_Item
 struct nrn_Item: public hoc_Item {};
@@ -214,6 +219,120 @@ void nrn_rangevar_push(Symbol* sym, Section* sec, double x) {
     hoc_push(nrn_rangepointer(sec, sym, x));
 }
 
+/****************************************
+ * Batched model building and access
+ ****************************************/
+
+void nrn_section_new_array(const char* name,
+                           int n,
+                           const int* parent,
+                           const double* parent_x,
+                           Section** sections) {
+    if (n < 1) {
+        hoc_execerror(name, ": the number of sections must be at least 1");
+    }
+    if (parent) {
+        for (int i = 0; i < n; ++i) {
+            if (parent[i] >= n || parent[i] == i) {
+                hoc_execerr_ext("%s[%d]: parent index %d is not another section of the array",
+                                name,
+                                i,
+                                parent[i]);
+            }
+        }
+        // as connect, refuse a loop, before any section exists. state 1 is
+        // on the path from the current section, 2 is known to reach a root
+        std::vector<char> state(n);
+        for (int i = 0; i < n; ++i) {
+            int j = i;
+            for (; j >= 0 && !state[j]; j = parent[j]) {
+                state[j] = 1;
+            }
+            if (j >= 0 && state[j] == 1) {
+                hoc_execerr_ext("%s[%d]: connection will form loop", name, j);
+            }
+            for (j = i; j >= 0 && state[j] == 1; j = parent[j]) {
+                state[j] = 2;
+            }
+        }
+    }
+    // one array symbol, as for "create name[n]", so the sections are name[i]
+    auto* symbol = new Symbol;
+    symbol->name = strdup(name);
+    symbol->type = 1;
+    symbol->u.oboff = 0;
+    symbol->arayinfo = 0;
+    hoc_install_object_data_index(symbol);
+    hoc_pushx(n);
+    hoc_arayinfo_install(symbol, 1);
+    auto* pitm = new hoc_Item*[n];
+    hoc_top_level_data[symbol->u.oboff].psecitm = pitm;
+    new_sections(nullptr, symbol, pitm, n);
+    for (int i = 0; i < n; ++i) {
+        sections[i] = pitm[i]->element.sec;
+    }
+    if (parent) {
+        for (int i = 0; i < n; ++i) {
+            if (parent[i] >= 0) {
+                nrn_section_connect(sections[i],
+                                    0.,
+                                    sections[parent[i]],
+                                    parent_x ? parent_x[i] : 1.);
+            }
+        }
+    }
+}
+
+void nrn_mechanism_insert_sectionlist(nrn_Item* sections, const Symbol* mechanism) {
+    SectionListIterator sli{sections};
+    while (!sli.done()) {
+        if (Section* sec = sli.next()) {
+            mech_insert1(sec, mechanism->subtype);
+        }
+    }
+}
+
+void nrn_rangevar_get_array(
+    Symbol* sym, int n, Section* const* secs, const double* x, double* values) {
+    RangeColumn const rv{sym};
+    for (int i = 0; i < n; ++i) {
+        rv.begin_get(secs[i]);
+        values[i] = rv(secs[i], x[i]);
+    }
+}
+
+void nrn_rangevar_set_array(
+    Symbol* sym, int n, Section* const* secs, const double* x, const double* values) {
+    RangeColumn const rv{sym, true};
+    for (int i = 0; i < n; ++i) {
+        if (rv.begin_set(secs[i])) {
+            rv(secs[i], x[i]) = values[i];
+            rv.end_set(secs[i]);
+        }
+    }
+}
+
+int nrn_rangevar_get_sectionlist(Symbol* sym, nrn_Item* sections, double* values) {
+    RangeColumn const rv{sym};
+    int n = 0;
+    SectionListIterator sli{sections};
+    while (!sli.done()) {
+        Section* sec = sli.next();
+        if (!sec) {
+            break;
+        }
+        int const nseg = sec->nnode - 1;
+        if (values) {
+            rv.begin_get(sec);
+            for (int i = 0; i < nseg; ++i) {
+                values[n + i] = rv(sec, i);
+            }
+        }
+        n += nseg;
+    }
+    return n;
+}
+
 nrn_Item* nrn_allsec(void) {
     return static_cast<nrn_Item*>(section_list);
 }
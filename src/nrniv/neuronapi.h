@@ -70,6 +70,21 @@ void nrn_rangevar_push(Symbol* sym, Section* sec, double x);
 double nrn_rangevar_get(Symbol* sym, Section* sec, double x);
 void nrn_rangevar_set(Symbol* sym, Section* sec, double x, double value);
 
+/****************************************
+ * Batched model building and access
+ ****************************************/
+void nrn_section_new_array(const char* name,
+                           int n,
+                           const int* parent,
+                           const double* parent_x,
+                           Section** sections);
+void nrn_mechanism_insert_sectionlist(nrn_Item* sections, const Symbol* mechanism);
+void nrn_rangevar_get_array(
+    Symbol* sym, int n, Section* const* secs, const double* x, double* values);
+void nrn_rangevar_set_array(
+    Symbol* sym, int n, Section* const* secs, const double* x, const double* values);
+int nrn_rangevar_get_sectionlist(Symbol* sym, nrn_Item* sections, double* values);
+
 /****************************************
  * Functions, objects, and the stack
  ****************************************/
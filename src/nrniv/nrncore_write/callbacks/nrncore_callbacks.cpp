@@ -377,6 +377,7 @@ int nrnthread_dat2_mech(int tid,
                         int dsz_inst,
                         int*& nodeindices,
                         double*& data,
+                        int data_stride,
                         int*& pdata,
                         std::vector<uint32_t>& nmodlrandom,  // 5 uint32_t per var per instance
                         std::vector<int>& pointer2type) {
@@ -397,48 +398,52 @@ int nrnthread_dat2_mech(int tid,
     int n_vars = ml->get_num_variables();
     int sz = nrn_prop_param_size_[type];
 
-    // As the NEURON data is now transposed then for now always create a new
-    // copy in the format expected by CoreNEURON.
-    // TODO remove the need for this entirely
-    if (!copy) {
-        data = new double[n * sz];
-    }
-    for (auto instance = 0, k = 0; instance < n; ++instance) {
-        for (int variable = 0; variable < n_vars; ++variable) {
+    if (copy && data_stride > 0) {
+        // Direct transfer into CoreNEURON's SoA layout: the instances of this thread are
+        // contiguous in each NEURON column, so every variable is a single block copy to offset
+        // data_stride * (sum of preceding array dims), with no intermediate instance-major copy.
+        assert(data_stride >= n);
+        for (int variable = 0, offset_var = 0; variable < n_vars; ++variable) {
             auto array_dim = ml->get_array_dims(variable);
-            for (int array_index = 0; array_index < array_dim; ++array_index) {
-                data[k++] = ml->data(instance, variable, array_index);
+            if (n) {
+                std::copy_n(&ml->data(0, variable), n * array_dim, data + data_stride * offset_var);
+            }
+            offset_var += array_dim;
+        }
+    } else {
+        // Instance-major rows, as in the file format.
+        if (!copy) {
+            data = new double[n * sz];
+        }
+        for (auto instance = 0, k = 0; instance < n; ++instance) {
+            for (int variable = 0; variable < n_vars; ++variable) {
+                auto array_dim = ml->get_array_dims(variable);
+                for (int array_index = 0; array_index < array_dim; ++array_index) {
+                    data[k++] = ml->data(instance, variable, array_index);
+                }
             }
         }
     }
 
     if (isart) {  // data may not be contiguous
         nodeindices = NULL;
+    } else if (copy) {
+        std::copy_n(ml->nodeindices, n, nodeindices);
     } else {
-        nodeindices = ml->nodeindices;  // allocated below if copy
-    }
-    if (copy) {
-        if (!isart) {
-            nodeindices = (int*) emalloc(n * sizeof(int));
-            for (int i = 0; i < n; ++i) {
-                nodeindices[i] = ml->nodeindices[i];
-            }
-        }
+        nodeindices = ml->nodeindices;
     }
 
     sz = bbcore_dparam_size[type];  // nrn_prop_dparam_size off by 1 if cvode_ieq.
     if (sz) {
-        int* pdata1;
-        pdata1 = datum2int(type, ml, nt, cg, cg.datumindices[dsz_inst], vdata_offset, pointer2type);
-        if (copy) {
-            int nn = n * sz;
-            for (int i = 0; i < nn; ++i) {
-                pdata[i] = pdata1[i];
-            }
-            delete[] pdata1;
-        } else {
-            pdata = pdata1;
-        }
+        // for direct transfer, fill the passed space in place
+        pdata = datum2int(type,
+                          ml,
+                          nt,
+                          cg,
+                          cg.datumindices[dsz_inst],
+                          vdata_offset,
+                          pointer2type,
+                          copy ? pdata : nullptr);
     } else {
         pdata = NULL;
     }
@@ -639,10 +644,13 @@ int* datum2int(int type,
                CellGroup& cg,
                DatumIndices& di,
                int ml_vdata_offset,
-               std::vector<int>& pointer2type) {
+               std::vector<int>& pointer2type,
+               int* pdata) {
     int isart = nrn_is_artificial_[di.type];
     int sz = bbcore_dparam_size[type];
-    int* pdata = new int[ml->nodecount * sz];
+    if (!pdata) {
+        pdata = new int[ml->nodecount * sz];
+    }
     int* semantics = memb_func[type].dparam_semantics.get();
     for (int i = 0; i < ml->nodecount; ++i) {
         int ioff = i * sz;
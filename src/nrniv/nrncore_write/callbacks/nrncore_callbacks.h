@@ -66,6 +66,7 @@ int nrnthread_dat2_mech(int tid,
                         int dsz_inst,
                         int*& nodeindices,
                         double*& data,
+                        int data_stride,
                         int*& pdata,
                         std::vector<uint32_t>& nmodlrandom,
                         std::vector<int>& pointer2type);
@@ -115,7 +116,8 @@ int* datum2int(int type,
                CellGroup& cg,
                DatumIndices& di,
                int ml_vdata_offset,
-               std::vector<int>& pointer2type);
+               std::vector<int>& pointer2type,
+               int* pdata = nullptr);
 }
 
 extern "C" {
@@ -208,7 +208,7 @@ void write_nrnthread(const char* path, NrnThread& nt, CellGroup& cg) {
         std::vector<int> pointer2type;
         std::vector<uint32_t> nmodlrandom;
         nrnthread_dat2_mech(
-            nt.id, i, dsz_inst, nodeindices, data, pdata, nmodlrandom, pointer2type);
+            nt.id, i, dsz_inst, nodeindices, data, 0, pdata, nmodlrandom, pointer2type);
         Memb_list* ml = mla[i].second;
         int n = ml->nodecount;
         int sz = nrn_prop_param_size_[type];
@@ -1,4 +1,6 @@
 #pragma once
+#include <cstddef>
+#include <functional>
 #include <string_view>
 #include <vector>
 /**
@@ -45,8 +47,15 @@ struct impl_ptrs {
     double (*object_to_double)(Object*){};
     void* (*opaque_obj2pyobj)(Object*){};
     Object* (*pickle2po)(const std::vector<char>&){};
+    // as pickle2po, upk fills its first argument with the next part of a
+    // pickle of the given total size
+    Object* (*upkpickle2po)(std::size_t, const std::function<void(char*, std::size_t)>& upk){};
     Object* (*po2ho)(PyObject*){};
     std::vector<char> (*po2pickle)(Object*){};
+    // as po2pickle but pk gets the parts of the pickle while they are valid,
+    // false (and pk is not called) if the Object is not a PythonObject
+    bool (*po2pickle_parts)(Object*,
+                            const std::function<void(const std::vector<std::string_view>&)>& pk){};
     double (*praxis_efun)(Object* pycallable, Object* hvec){};
     int (*pysame)(Object* o1, Object* o2){};
     void (*py2n_component)(Object*, Symbol*, int, int){};
@@ -144,6 +144,7 @@ extern void (*nrnthread_v_transfer_)(NrnThread*);  // before nonvint and BEFORE
 extern void (*nrnthread_vi_compute_)(NrnThread*);
 extern void (*nrnmpi_v_transfer_)();  // before nrnthread_v_transfer and after update. Called by
                                       // thread 0.
+extern void (*nrnmpi_v_transfer_lagged_)();  // instead of nrnmpi_v_transfer by the fixed step
 extern void (*nrn_mk_transfer_thread_data_)();
 #if NRNMPI
 extern double nrnmpi_transfer_wait_;
@@ -180,6 +181,18 @@ static std::vector<neuron::container::data_handle<double>> poutsrc_;  // prior t
                                                                       // to proper place in
                                                                       // outsrc_buf_
 static int* poutsrc_indices_;                                         // for recalc pointers
+// The interprocessor transfer is a persistent point to point exchange
+// between the ranks that share sources, built by nrnmpi_setup_transfer.
+// It is at least as sparse as the nrnmpi_dbl_alltoallv_sparse that
+// nrn_sparse_partrans > 0 used to select, so that flag now only applies
+// to the sgid exchanges of the setup.
+// With setup_transfer(1) the fixed step method completes the exchange
+// started after one update only after the next update (mpi_transfer_lagged).
+#define PARTRANS_TAG 101981
+static void* transfer_exchange_;
+static bool transfer_pending_;  // started but not completed
+static int transfer_lag_;
+static double* inlag_buf_;  // receives the lagged exchange, copied to insrc_buf_
 static int insrc_buf_size_;
 static std::vector<int> insrccnt_;
 static std::vector<int> insrcdspl_;
@@ -545,28 +558,39 @@ static void thread_vi_compute(NrnThread* _nt) {
     }
 }
 
+static void transfer_exchange_free() {
+#if NRNMPI
+    if (transfer_exchange_) {
+        if (transfer_pending_) {
+            nrnmpi_dbl_exchange_wait(&transfer_exchange_);
+            transfer_pending_ = false;
+        }
+        nrnmpi_dbl_exchange_free(&transfer_exchange_);
+    }
+#endif
+    delete[] std::exchange(inlag_buf_, nullptr);
+}
+
 static void mpi_transfer() {
     int i, n = outsrc_buf_size_;
+#if NRNMPI
+    // a lagged exchange still in flight must complete before the send
+    // buffer is refilled
+    if (transfer_pending_) {
+        nrnmpi_dbl_exchange_wait(&transfer_exchange_);
+        transfer_pending_ = false;
+    }
+#endif
     for (i = 0; i < n; ++i) {
         outsrc_buf_[i] = *poutsrc_[i];
     }
 #if NRNMPI
-    if (nrnmpi_numprocs > 1) {
+    if (nrnmpi_numprocs > 1 && transfer_exchange_) {
         double wt = nrnmpi_wtime();
-        if (nrn_sparse_partrans > 0) {
-            nrnmpi_dbl_alltoallv_sparse(outsrc_buf_,
-                                        outsrccnt_.data(),
-                                        outsrcdspl_.data(),
-                                        insrc_buf_,
-                                        insrccnt_.data(),
-                                        insrcdspl_.data());
-        } else {
-            nrnmpi_dbl_alltoallv(outsrc_buf_,
-                                 outsrccnt_.data(),
-                                 outsrcdspl_.data(),
-                                 insrc_buf_,
-                                 insrccnt_.data(),
-                                 insrcdspl_.data());
+        nrnmpi_dbl_exchange_start(&transfer_exchange_);
+        nrnmpi_dbl_exchange_wait(&transfer_exchange_);
+        if (inlag_buf_) {
+            std::copy(inlag_buf_, inlag_buf_ + insrc_buf_size_, insrc_buf_);
         }
         nrnmpi_transfer_wait_ += nrnmpi_wtime() - wt;
         errno = 0;
@@ -575,6 +599,31 @@ static void mpi_transfer() {
     // insrc_buf_ will get transferred to targets by thread_transfer
 }
 
+#if NRNMPI
+// The fixed step transfer with setup_transfer(1). Completes the exchange
+// started after the previous update, so that it overlaps a whole time step
+// instead of stalling every rank in the transfer, and starts the exchange
+// of the sources just updated. Targets of sources on other ranks therefore
+// see the values of the previous step, as in a Jacobi iteration. Targets of
+// sources on this rank are not lagged. Initialization, the variable step
+// methods and impedance use the complete mpi_transfer.
+static void mpi_transfer_lagged() {
+    int i, n = outsrc_buf_size_;
+    if (transfer_pending_) {
+        double wt = nrnmpi_wtime();
+        nrnmpi_dbl_exchange_wait(&transfer_exchange_);
+        std::copy(inlag_buf_, inlag_buf_ + insrc_buf_size_, insrc_buf_);
+        nrnmpi_transfer_wait_ += nrnmpi_wtime() - wt;
+    }
+    for (i = 0; i < n; ++i) {
+        outsrc_buf_[i] = *poutsrc_[i];
+    }
+    nrnmpi_dbl_exchange_start(&transfer_exchange_);
+    transfer_pending_ = true;
+    errno = 0;
+}
+#endif
+
 static void thread_transfer(NrnThread* _nt) {
     if (!is_setup_) {
         hoc_execerror("ParallelContext.setup_transfer()", "needs to be called.");
@@ -617,7 +666,7 @@ static void thread_transfer(NrnThread* _nt) {
 // "  But this was a mistake as many mpi implementations do not allow overlap
 // of send and receive buffers.
 
-void nrnmpi_setup_transfer() {
+void nrnmpi_setup_transfer(int lag) {
 #if !NRNMPI
     if (nrnmpi_numprocs > 1) {
         hoc_execerror(
@@ -629,6 +678,9 @@ void nrnmpi_setup_transfer() {
     int nhost = nrnmpi_numprocs;
     is_setup_ = true;
     delete_imped_info();
+    transfer_exchange_free();
+    transfer_lag_ = lag;
+    nrnmpi_v_transfer_lagged_ = nullptr;
     delete[] std::exchange(insrc_buf_, nullptr);
     delete[] std::exchange(outsrc_buf_, nullptr);
     outsrc_buf_size_ = 0;
@@ -756,7 +808,23 @@ void nrnmpi_setup_transfer() {
         insrc_buf_ = new double[szalloc];
         // from sid2insrc_, mk_ttd can construct the right pointer to the source.
 
+        // 5) Each rank only exchanges with the ranks it shares sources with.
+        if (transfer_lag_) {
+            inlag_buf_ = new double[szalloc];
+        }
+        nrnmpi_dbl_exchange_init(outsrc_buf_,
+                                 outsrccnt_.data(),
+                                 outsrcdspl_.data(),
+                                 transfer_lag_ ? inlag_buf_ : insrc_buf_,
+                                 insrccnt_.data(),
+                                 insrcdspl_.data(),
+                                 PARTRANS_TAG,
+                                 &transfer_exchange_);
+
         nrnmpi_v_transfer_ = mpi_transfer;
+        if (transfer_lag_) {
+            nrnmpi_v_transfer_lagged_ = mpi_transfer_lagged;
+        }
     }
 #endif  // NRNMPI
     nrn_mk_transfer_thread_data_ = mk_ttd;
@@ -769,6 +837,8 @@ void nrn_partrans_clear() {
     nrnthread_v_transfer_ = nullptr;
     nrnthread_vi_compute_ = nullptr;
     nrnmpi_v_transfer_ = nullptr;
+    nrnmpi_v_transfer_lagged_ = nullptr;
+    transfer_exchange_free();
     sgid2srcindex_.clear();
     sgids_.resize(0);
     visources_.resize(0);
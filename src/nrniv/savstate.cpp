@@ -13,6 +13,10 @@
 #include "netcon.h"
 #include "vrecitem.h"
 #include "utils/enumerate.h"
+#include "neuron/model_data.hpp"
+
+#include <algorithm>
+#include <vector>
 
 typedef void (*ReceiveFunc)(Point_process*, double*, double);
 
@@ -79,12 +83,23 @@ class SaveState: public Resource {
         double* tdeliver;
         DiscreteEvent** items;
     };
+    // Whole-column copy of the saved part of one SoA container. Valid for
+    // restore only while the container's layout_generation() is unchanged.
+    struct ColumnState {
+        const void* storage;  // nullptr if the mechanism storage did not exist
+        std::size_t generation;
+        std::vector<int> fields;  // FloatingPoint field indices, empty for Node
+        std::vector<double> data;
+    };
 
   private:
     bool check(bool warn);
     void alloc();
     void ssfree();
     void ssi_def();
+    void save_columns();
+    bool columns_match();
+    void restore_columns();
 
   private:
     void fread_NodeState(NodeState*, int, FILE*);
@@ -111,6 +126,9 @@ class SaveState: public Resource {
     cTemplate* nct;
     char* plugin_data_;
     uint64_t plugin_size_;
+    // columns_[0] is Node voltage, then one per type in column_types_
+    std::vector<ColumnState> columns_;
+    std::vector<int> column_types_;
 
   private:
     void savenode(NodeState&, Node*);
@@ -266,6 +284,15 @@ void SaveState::ssi_def() {
                 }
             }
         }
+#if EXTRACELLULAR
+        // extracellular state lives in Extnode, not in the mechanism storage
+        if (im == EXTRACELL) {
+            continue;
+        }
+#endif
+        if (ssi[im].size) {
+            column_types_.push_back(im);
+        }
     }
 }
 
@@ -591,6 +618,7 @@ void SaveState::ssfree() {
         plugin_data_ = NULL;
         plugin_size_ = 0;
     }
+    columns_.clear();
 }
 
 void SaveState::save() {
@@ -634,6 +662,102 @@ void SaveState::save() {
         plugin_size_ = 0;
         plugin_data_ = NULL;
     }
+    save_columns();
+}
+
+// In addition to the per node copy above (which is what gets written to a
+// file and what restore falls back to), keep a copy of the saved variables
+// as whole SoA columns. As long as no row of the Node or mechanism storage
+// has been created, destroyed or permuted, restore can then copy the columns
+// back without walking sections, nodes and Prop lists.
+void SaveState::save_columns() {
+    columns_.clear();
+#if EXTRACELLULAR
+    // Extnode::v is not in SoA storage, so always use the slow path.
+    if (neuron::model().is_valid_mechanism(EXTRACELL) &&
+        neuron::model().mechanism_data(EXTRACELL).size()) {
+        return;
+    }
+#endif
+    using neuron::container::Mechanism::field::FloatingPoint;
+    using neuron::container::Node::field::Voltage;
+    columns_.resize(1 + column_types_.size());
+    auto& node_data = neuron::model().node_data();
+    ColumnState& vcol = columns_[0];
+    vcol.storage = &node_data;
+    vcol.generation = node_data.layout_generation();
+    vcol.data.assign(node_data.get_data_ptrs<Voltage>()[0],
+                     node_data.get_data_ptrs<Voltage>()[0] + node_data.size());
+    for (auto&& [i, type]: enumerate(column_types_)) {
+        ColumnState& col = columns_[i + 1];
+        col.storage = nullptr;
+        if (!neuron::model().is_valid_mechanism(type)) {
+            continue;
+        }
+        auto& mech_data = neuron::model().mechanism_data(type);
+        col.storage = &mech_data;
+        col.generation = mech_data.layout_generation();
+        std::size_t const n = mech_data.size();
+        for (int ip = ssi[type].offset; ip < ssi[type].offset + ssi[type].size; ++ip) {
+            int const field = mech_data.translate_legacy_index<FloatingPoint>(ip).field;
+            if (col.fields.empty() || col.fields.back() != field) {
+                col.fields.push_back(field);
+            }
+        }
+        for (int field: col.fields) {
+            double const* const begin = mech_data.get_data_ptrs<FloatingPoint>()[field];
+            std::size_t const len = n * mech_data.get_array_dims<FloatingPoint>()[field];
+            col.data.insert(col.data.end(), begin, begin + len);
+        }
+    }
+}
+
+bool SaveState::columns_match() {
+    if (columns_.empty()) {
+        return false;
+    }
+    auto& node_data = neuron::model().node_data();
+    if (columns_[0].storage != &node_data ||
+        columns_[0].generation != node_data.layout_generation()) {
+        return false;
+    }
+    for (auto&& [i, type]: enumerate(column_types_)) {
+        ColumnState const& col = columns_[i + 1];
+        if (!neuron::model().is_valid_mechanism(type)) {
+            if (col.storage) {
+                return false;
+            }
+            continue;
+        }
+        auto const& mech_data = neuron::model().mechanism_data(type);
+        if (col.storage != &mech_data || col.generation != mech_data.layout_generation()) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void SaveState::restore_columns() {
+    using neuron::container::Mechanism::field::FloatingPoint;
+    using neuron::container::Node::field::Voltage;
+    auto& node_data = neuron::model().node_data();
+    std::copy(columns_[0].data.begin(),
+              columns_[0].data.end(),
+              node_data.get_data_ptrs<Voltage>()[0]);
+    for (auto&& [i, type]: enumerate(column_types_)) {
+        ColumnState const& col = columns_[i + 1];
+        if (!col.storage) {
+            continue;
+        }
+        auto& mech_data = neuron::model().mechanism_data(type);
+        std::size_t const n = mech_data.size();
+        double const* src = col.data.data();
+        for (int field: col.fields) {
+            std::size_t const len = n * mech_data.get_array_dims<FloatingPoint>()[field];
+            std::copy(src, src + len, mech_data.get_data_ptrs<FloatingPoint>()[field]);
+            src += len;
+        }
+    }
 }
 
 void SaveState::savenode(NodeState& ns, Node* nd) {
@@ -672,32 +796,39 @@ void SaveState::saveacell(ACellState& ac, int type) {
 }
 
 void SaveState::restore(int type) {
-    if (!check(true)) {
+    // If no SoA row moved since save(), the section and mechanism structure
+    // is necessarily the same, so only the NetCon part needs checking.
+    bool const fast = columns_match();
+    if (!(fast ? checknet(true) : check(true))) {
         hoc_execerror("SaveState:", "Stored state inconsistent with current neuron structure");
     }
     t = t_;
     for (NrnThread* nt: for_threads(nrn_threads, nrn_nthread)) {
         nt->_t = t_;
     }
-    for (int isec = 0; isec < nsec_; ++isec) {
-        SecState& ss = ss_[isec];
-        Section* sec = ss.sec;
-        for (int inode = 0; inode < ss.nnode; ++inode) {
-            NodeState& ns = ss.ns[inode];
-            Node* nd = sec->pnode[inode];
-            restorenode(ns, nd);
-        }
-        if (ss.root) {
-            NodeState& ns = *ss.root;
-            Node* nd = sec->parentnode;
-            restorenode(ns, nd);
+    if (fast) {
+        restore_columns();
+    } else {
+        for (int isec = 0; isec < nsec_; ++isec) {
+            SecState& ss = ss_[isec];
+            Section* sec = ss.sec;
+            for (int inode = 0; inode < ss.nnode; ++inode) {
+                NodeState& ns = ss.ns[inode];
+                Node* nd = sec->pnode[inode];
+                restorenode(ns, nd);
+            }
+            if (ss.root) {
+                NodeState& ns = *ss.root;
+                Node* nd = sec->parentnode;
+                restorenode(ns, nd);
+            }
         }
+        for (int i = 0, j = 0; i < n_memb_func; ++i)
+            if (nrn_is_artificial_[i]) {
+                restoreacell(acell_[j], i);
+                ++j;
+            }
     }
-    for (int i = 0, j = 0; i < n_memb_func; ++i)
-        if (nrn_is_artificial_[i]) {
-            restoreacell(acell_[j], i);
-            ++j;
-        }
     if (type == 1) {
         return;
     }
@@ -25,10 +25,28 @@ void nrn_vecsim_remove(void* v) {
     }
 }
 
+// Vector.record_load([start [, n]])
+void nrn_vecsim_load(void* v) {
+    auto* vrs = dynamic_cast<VecRecordStream*>(net_cvode_instance->playrec_uses(v));
+    if (!vrs) {
+        hoc_execerror(hoc_object_name(((IvocVect*) v)->obj_), "is not recording to a file");
+    }
+    size_t start = 0;
+    size_t n = vrs->count();
+    if (ifarg(1)) {
+        start = (size_t) chkarg(1, 0., 1e18);
+    }
+    if (ifarg(2)) {
+        n = (size_t) chkarg(2, 0., 1e18);
+    }
+    vrs->load((IvocVect*) v, start, n);
+}
+
 void nrn_vecsim_add(void* v, bool record) {
     IvocVect *yvec, *tvec, *dvec;
     extern short* nrn_is_artificial_;
     char* s = NULL;
+    char* fname = NULL;
     double ddt;
     Object* ppobj = NULL;
     int iarg = 0;
@@ -67,7 +85,10 @@ void nrn_vecsim_add(void* v, bool record) {
     dvec = NULL;
     ddt = -1.;
     int con = 0;
-    if (ifarg(iarg + 2)) {
+    if (record && ifarg(iarg + 2) && hoc_is_str_arg(iarg + 2)) {
+        // Vector.record(&var, "filename")
+        fname = gargstr(iarg + 2);
+    } else if (ifarg(iarg + 2)) {
         if (hoc_is_object_arg(iarg + 2)) {
             // Vector...(..., tvec)
             tvec = vector_arg(iarg + 2);
@@ -75,7 +96,10 @@ void nrn_vecsim_add(void* v, bool record) {
             // Vector...(..., Dt)
             ddt = chkarg(iarg + 2, 1e-9, 1e10);
         }
-        if (ifarg(iarg + 3)) {
+        if (record && ifarg(iarg + 3) && hoc_is_str_arg(iarg + 3)) {
+            // Vector.record(&var, Dt, "filename")
+            fname = gargstr(iarg + 3);
+        } else if (ifarg(iarg + 3)) {
             if (hoc_is_double_arg(iarg + 3)) {
                 con = (int) chkarg(iarg + 3, 0., 1.);
             } else {
@@ -92,7 +116,16 @@ void nrn_vecsim_add(void* v, bool record) {
         if (yvec) {
             nrn_vecsim_remove(yvec);
         }
-        if (tvec) {
+        if (fname) {
+            if (tvec) {
+                hoc_execerror("Vector.record to a file does not support a time Vector", 0);
+            }
+            auto* vrs = new VecRecordStream(std::move(dh), yvec, ddt, fname, ppobj);
+            if (!vrs->is_open()) {
+                delete vrs;
+                hoc_execerror("Vector.record: could not open for writing", fname);
+            }
+        } else if (tvec) {
             new VecRecordDiscrete(std::move(dh), yvec, tvec, ppobj);
         } else if (ddt > 0.) {
             new VecRecordDt(std::move(dh), yvec, ddt, ppobj);
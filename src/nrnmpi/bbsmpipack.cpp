@@ -13,6 +13,7 @@
 
 #if NRNMPI
 #include <string.h>
+#include <limits.h>
 #include <assert.h>
 #include <errno.h>
 #include <mpi.h>
@@ -185,26 +186,68 @@ char* nrnmpi_upkstr(bbsmpibuf* r) {
     return s;
 }
 
-char* nrnmpi_upkpickle(size_t* size, bbsmpibuf* r) {
+/* a pickle is unpacked in two steps so the caller can unpack straight into
+   its own storage */
+int nrnmpi_upkpickle_size(bbsmpibuf* r) {
     int len;
-    char* s;
     unpack(&len, 1, my_MPI_INT, r, "upkpickle length");
-    *size = len;
-#if NRNMPI_DYNAMICLOAD
-    s = (*p_cxx_char_alloc)(len + 1); /* will be delete not free */
-#else
-    s = cxx_char_alloc(len + 1); /* will be delete, not free */
-#endif
-    unpack(s, len, my_MPI_PICKLE, r, "upkpickle data");
+    return len;
+}
+
+void nrnmpi_upkpickle_data(char* s, int size, bbsmpibuf* r) {
+    unpack(s, size, my_MPI_PICKLE, r, "upkpickle data");
+}
+
+/* A pickle may also be unpacked in consecutive parts, e.g. straight into the
+   out of band buffers of a protocol 5 pickle. nrnmpi_upkpickle_begin returns
+   the total size and the sizes of the parts must add up to it. */
+int nrnmpi_upkpickle_begin(bbsmpibuf* r) {
+    int len, type[2];
+    unpack(&len, 1, my_MPI_INT, r, "upkpickle length");
+    nrn_mpi_assert(MPI_Unpack(r->buf, r->size, &r->upkpos, type, 2, MPI_INT, nrn_bbs_comm));
+    assert(type[0] == my_MPI_PICKLE);
+    assert(type[1] == len);
+    return len;
+}
+
+void nrnmpi_upkpickle_part(char* s, int size, bbsmpibuf* r) {
+    nrn_mpi_assert(MPI_Unpack(r->buf, r->size, &r->upkpos, s, size, MPI_CHAR, nrn_bbs_comm));
+}
+
+/* a whole message packed inside another, as received by nrnmpi_bbsrecv */
+bbsmpibuf* nrnmpi_upkbuf(bbsmpibuf* r) {
+    int len;
+    bbsmpibuf* s;
+    unpack(&len, 1, my_MPI_INT, r, "upkbuf length");
+    s = nrnmpi_newbuf(len);
+    unpack(s->buf, len, my_MPI_PACKED, r, "upkbuf data");
     return s;
 }
 
+/* Freed buffers are kept for reuse so that a farm does not allocate and free
+   the storage of every message. Storage only grows, at least doubling each
+   time, so a buffer is reallocated a few times on the way to the size of its
+   largest message. Only buffers up to POOLMAXCAPACITY bytes are kept, which
+   bounds the memory held by the pool after an occasional huge message.
+*/
+#define POOLSIZE        16
+#define POOLMAXCAPACITY (1 << 20)
+static bbsmpibuf* pool_[POOLSIZE];
+static int npool_;
+
 static void resize(bbsmpibuf* r, int size) {
-    int newsize;
+    int newsize, capacity;
     if (r->size < size) {
         newsize = (size / 64) * 64 + 128;
-        r->buf = static_cast<char*>(hoc_Erealloc(r->buf, newsize));
-        hoc_malchk();
+        if (r->capacity < newsize) {
+            capacity = r->capacity < INT_MAX / 2 ? 2 * r->capacity : INT_MAX;
+            if (capacity < newsize) {
+                capacity = newsize;
+            }
+            r->buf = static_cast<char*>(hoc_Erealloc(r->buf, capacity));
+            hoc_malchk();
+            r->capacity = capacity;
+        }
         r->size = newsize;
     }
 }
@@ -320,6 +363,32 @@ void nrnmpi_pkpickle(const char* s, size_t size, bbsmpibuf* r) {
     pack((char*) s, len, my_MPI_PICKLE, r, "pkpickle data");
 }
 
+/* The counterpart of nrnmpi_upkpickle_begin/part. The result is the same as
+   nrnmpi_pkpickle of the concatenated parts. */
+void nrnmpi_pkpickle_begin(size_t size, bbsmpibuf* r) {
+    int len = size;
+    int type[2] = {my_MPI_PICKLE, len};
+    int dsize, isize;
+    pack(&len, 1, my_MPI_INT, r, "pkpickle length");
+    nrn_mpi_assert(MPI_Pack_size(len, MPI_CHAR, nrn_bbs_comm, &dsize));
+    nrn_mpi_assert(MPI_Pack_size(2, MPI_INT, nrn_bbs_comm, &isize));
+    resize(r, r->pkposition + dsize + isize);
+    nrn_mpi_assert(MPI_Pack(type, 2, MPI_INT, r->buf, r->size, &r->pkposition, nrn_bbs_comm));
+}
+
+void nrnmpi_pkpickle_part(const char* s, size_t size, bbsmpibuf* r) {
+    int dsize;
+    nrn_mpi_assert(MPI_Pack_size(int(size), MPI_CHAR, nrn_bbs_comm, &dsize));
+    resize(r, r->pkposition + dsize);
+    nrn_mpi_assert(MPI_Pack(
+        (char*) s, int(size), MPI_CHAR, r->buf, r->size, &r->pkposition, nrn_bbs_comm));
+}
+
+void nrnmpi_pkbuf(bbsmpibuf* s, bbsmpibuf* r) {
+    pack(&s->size, 1, my_MPI_INT, r, "pkbuf length");
+    pack(s->buf, s->size, my_MPI_PACKED, r, "pkbuf data");
+}
+
 void nrnmpi_bbssend(int dest, int tag, bbsmpibuf* r) {
 #if debug
     printf("%d nrnmpi_bbssend %p dest=%d tag=%d size=%d\n",
@@ -439,17 +508,38 @@ void nrnmpi_probe(int* size, int* tag, int* source) {
 
 bbsmpibuf* nrnmpi_newbuf(int size) {
     bbsmpibuf* buf;
-    buf = (bbsmpibuf*) hoc_Emalloc(sizeof(bbsmpibuf));
-    hoc_malchk();
+    int i, j, ci, cj;
+    if (npool_) {
+        /* the smallest that fits, else the largest */
+        j = 0;
+        for (i = 1; i < npool_; ++i) {
+            ci = pool_[i]->capacity;
+            cj = pool_[j]->capacity;
+            if (cj < size ? ci > cj : ci >= size && ci < cj) {
+                j = i;
+            }
+        }
+        buf = pool_[j];
+        pool_[j] = pool_[--npool_];
+        if (buf->capacity < size) {
+            buf->size = 0;
+            resize(buf, size);
+        }
+        buf->size = size;
+    } else {
+        buf = (bbsmpibuf*) hoc_Emalloc(sizeof(bbsmpibuf));
+        hoc_malchk();
+        buf->buf = (char*) 0;
+        if (size > 0) {
+            buf->buf = static_cast<char*>(hoc_Emalloc(size * sizeof(char)));
+            hoc_malchk();
+        }
+        buf->size = size;
+        buf->capacity = size;
+    }
 #if debug
     printf("%d nrnmpi_newbuf %p\n", nrnmpi_myid_bbs, buf);
 #endif
-    buf->buf = (char*) 0;
-    if (size > 0) {
-        buf->buf = static_cast<char*>(hoc_Emalloc(size * sizeof(char)));
-        hoc_malchk();
-    }
-    buf->size = size;
     buf->pkposition = 0;
     buf->upkpos = 0;
     buf->keypos = 0;
@@ -472,16 +562,35 @@ void nrnmpi_copy(bbsmpibuf* dest, bbsmpibuf* src) {
 }
 
 static void nrnmpi_free(bbsmpibuf* buf) {
+    int i, j;
 #if debug
     printf("%d nrnmpi_free %p\n", nrnmpi_myid_bbs, buf);
 #endif
+#if nrnmpidebugleak
+    --nrnmpi_bufcnt_; /* counts buffers in use, not those in the pool */
+#endif
+    if (buf->capacity <= POOLMAXCAPACITY) {
+        if (npool_ < POOLSIZE) {
+            pool_[npool_++] = buf;
+            return;
+        }
+        /* pool is full. Keep the larger and free the smallest */
+        j = 0;
+        for (i = 1; i < npool_; ++i) {
+            if (pool_[i]->capacity < pool_[j]->capacity) {
+                j = i;
+            }
+        }
+        if (pool_[j]->capacity < buf->capacity) {
+            bbsmpibuf* b = pool_[j];
+            pool_[j] = buf;
+            buf = b;
+        }
+    }
     if (buf->buf) {
         free(buf->buf);
     }
     free(buf);
-#if nrnmpidebugleak
-    --nrnmpi_bufcnt_;
-#endif
 }
 
 void nrnmpi_ref(bbsmpibuf* buf) {
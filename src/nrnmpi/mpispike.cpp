@@ -22,6 +22,7 @@
 
 #include <limits>
 #include <string>
+#include <vector>
 
 #define nrn_mpi_assert(arg) nrn_assert(arg == MPI_SUCCESS)
 
@@ -615,6 +616,88 @@ void nrnmpi_wait(void** request) {
     MPI_Wait((MPI_Request*) request, &status);
 }
 
+/* Persistent point to point requests for messages repeated every time step.
+   Begin each with nrnmpi_start and complete it with nrnmpi_wait. The buffer
+   is fixed when the request is created.
+*/
+void nrnmpi_send_init_doubles(double* pd, int cnt, int dest, int tag, void** request) {
+    nrn_mpi_assert(
+        MPI_Send_init(pd, cnt, MPI_DOUBLE, dest, tag, nrnmpi_comm, (MPI_Request*) request));
+}
+
+void nrnmpi_recv_init_doubles(double* pd, int cnt, int src, int tag, void** request) {
+    nrn_mpi_assert(
+        MPI_Recv_init(pd, cnt, MPI_DOUBLE, src, tag, nrnmpi_comm, (MPI_Request*) request));
+}
+
+void nrnmpi_start(void** request) {
+    nrn_mpi_assert(MPI_Start((MPI_Request*) request));
+}
+
+void nrnmpi_request_free(void** request) {
+    MPI_Request_free((MPI_Request*) request);
+}
+
+/* A persistent exchange of doubles with the same counts and displacements
+   as nrnmpi_dbl_alltoallv, for patterns repeated every time step. Only the
+   ranks with nonzero counts are contacted, by point to point requests that
+   are created once. The buffers must stay valid until the exchange is freed
+   and the send buffer must not change between start and wait.
+*/
+struct NrnmpiExchange {
+    std::vector<MPI_Request> requests;
+};
+
+void nrnmpi_dbl_exchange_init(double* s,
+                              int* scnt,
+                              int* sdispl,
+                              double* r,
+                              int* rcnt,
+                              int* rdispl,
+                              int tag,
+                              void** exchange) {
+    auto* ex = new NrnmpiExchange;
+    for (int i = 0; i < nrnmpi_numprocs; ++i) {
+        if (rcnt[i]) {
+            ex->requests.emplace_back();
+            nrn_mpi_assert(MPI_Recv_init(
+                r + rdispl[i], rcnt[i], MPI_DOUBLE, i, tag, nrnmpi_comm, &ex->requests.back()));
+        }
+    }
+    for (int i = 0; i < nrnmpi_numprocs; ++i) {
+        if (scnt[i]) {
+            ex->requests.emplace_back();
+            nrn_mpi_assert(MPI_Send_init(
+                s + sdispl[i], scnt[i], MPI_DOUBLE, i, tag, nrnmpi_comm, &ex->requests.back()));
+        }
+    }
+    *exchange = ex;
+}
+
+void nrnmpi_dbl_exchange_start(void** exchange) {
+    auto* ex = static_cast<NrnmpiExchange*>(*exchange);
+    if (!ex->requests.empty()) {
+        nrn_mpi_assert(MPI_Startall(ex->requests.size(), ex->requests.data()));
+    }
+}
+
+void nrnmpi_dbl_exchange_wait(void** exchange) {
+    auto* ex = static_cast<NrnmpiExchange*>(*exchange);
+    if (!ex->requests.empty()) {
+        nrn_mpi_assert(
+            MPI_Waitall(ex->requests.size(), ex->requests.data(), MPI_STATUSES_IGNORE));
+    }
+}
+
+void nrnmpi_dbl_exchange_free(void** exchange) {
+    auto* ex = static_cast<NrnmpiExchange*>(*exchange);
+    for (auto& request: ex->requests) {
+        MPI_Request_free(&request);
+    }
+    delete ex;
+    *exchange = nullptr;
+}
+
 void nrnmpi_barrier() {
     if (nrnmpi_numprocs < 2) {
         return;
@@ -16,6 +16,7 @@ using longdbl = long double;
 typedef struct bbsmpibuf {
     char* buf;
     int size;
+    int capacity; /* allocated, at least size */
     int pkposition;
     int upkpos;
     int keypos;
@@ -45,7 +46,11 @@ extern int nrnmpi_upkint(bbsmpibuf* buf);
 extern double nrnmpi_upkdouble(bbsmpibuf* buf);
 extern void nrnmpi_upkvec(int n, double* x, bbsmpibuf* buf);
 extern char* nrnmpi_upkstr(bbsmpibuf* buf);
-extern char* nrnmpi_upkpickle(size_t* size, bbsmpibuf* buf);
+extern int nrnmpi_upkpickle_size(bbsmpibuf* buf);
+extern void nrnmpi_upkpickle_data(char* s, int size, bbsmpibuf* buf);
+extern int nrnmpi_upkpickle_begin(bbsmpibuf* buf);
+extern void nrnmpi_upkpickle_part(char* s, int size, bbsmpibuf* buf);
+extern bbsmpibuf* nrnmpi_upkbuf(bbsmpibuf* buf);
 
 extern void nrnmpi_pkbegin(bbsmpibuf* buf);
 extern void nrnmpi_enddata(bbsmpibuf* buf);
@@ -54,6 +59,9 @@ extern void nrnmpi_pkdouble(double x, bbsmpibuf* buf);
 extern void nrnmpi_pkvec(int n, double* x, bbsmpibuf* buf);
 extern void nrnmpi_pkstr(const char* s, bbsmpibuf* buf);
 extern void nrnmpi_pkpickle(const char* s, size_t size, bbsmpibuf* buf);
+extern void nrnmpi_pkpickle_begin(size_t size, bbsmpibuf* buf);
+extern void nrnmpi_pkpickle_part(const char* s, size_t size, bbsmpibuf* buf);
+extern void nrnmpi_pkbuf(bbsmpibuf* s, bbsmpibuf* buf);
 
 extern int nrnmpi_iprobe(int* size, int* tag, int* source);
 extern void nrnmpi_probe(int* size, int* tag, int* source);
@@ -114,6 +122,14 @@ extern void nrnmpi_send_doubles(double* pd, int cnt, int dest, int tag);
 extern void nrnmpi_recv_doubles(double* pd, int cnt, int src, int tag);
 extern void nrnmpi_postrecv_doubles(double* pd, int cnt, int src, int tag, void** request);
 extern void nrnmpi_wait(void** request);
+extern void nrnmpi_send_init_doubles(double* pd, int cnt, int dest, int tag, void** request);
+extern void nrnmpi_recv_init_doubles(double* pd, int cnt, int src, int tag, void** request);
+extern void nrnmpi_start(void** request);
+extern void nrnmpi_request_free(void** request);
+extern void nrnmpi_dbl_exchange_init(double* s, int* scnt, int* sdispl, double* r, int* rcnt, int* rdispl, int tag, void** exchange);
+extern void nrnmpi_dbl_exchange_start(void** exchange);
+extern void nrnmpi_dbl_exchange_wait(void** exchange);
+extern void nrnmpi_dbl_exchange_free(void** exchange);
 extern void nrnmpi_barrier();
 extern double nrnmpi_dbl_allreduce(double x, int type);
 
@@ -9,7 +9,7 @@
 
 namespace {
 void invalidate_cache() {
-    neuron::cache::model.reset();
+    neuron::cache::invalidate();
 }
 }  // namespace
 namespace neuron {
@@ -57,7 +57,15 @@ Model model_data;
 }  // namespace neuron::detail
 namespace neuron::cache {
 std::optional<Model> model{};
+std::optional<Model> stale_model{};
+SortStats last_sort{};
+void invalidate() {
+    if (model) {
+        stale_model = std::move(model);
+        model.reset();
+    }
 }
+}  // namespace neuron::cache
 namespace neuron::container {
 std::ostream& operator<<(std::ostream& os, generic_data_handle const& dh) {
     os << "generic_data_handle{";
@@ -58,11 +58,10 @@ static void nonvint(neuron::model_sorted_token const&, NrnThread&);
 extern void nrncvode_set_t(double t);
 
 static void* nrn_ms_treeset_through_triang(NrnThread*);
-static void* nrn_ms_reduce_solve(NrnThread*);
 static void* nrn_ms_bksub(NrnThread*);
 static void* nrn_ms_bksub_through_triang(NrnThread*);
 extern void* nrn_multisplit_triang(NrnThread*);
-extern void* nrn_multisplit_reduce_solve(NrnThread*);
+extern void nrn_multisplit_reduce_solve();
 extern void* nrn_multisplit_bksub(NrnThread*);
 extern void (*nrn_multisplit_setup_)();
 void (*nrn_allthread_handle)();
@@ -136,6 +135,9 @@ existence of nrnthread_v_transfer (even if one thread).
 */
 #if 1 || NRNMPI
 void (*nrnmpi_v_transfer_)(); /* called by thread 0 */
+/* if not nullptr, called instead of nrnmpi_v_transfer by the fixed step,
+   see mpi_transfer_lagged in partrans.cpp */
+void (*nrnmpi_v_transfer_lagged_)();
 void (*nrnthread_v_transfer_)(NrnThread* nt);
 /* if at least one gap junction has a source voltage with extracellular inserted */
 void (*nrnthread_vi_compute_)(NrnThread* nt);
@@ -338,13 +340,13 @@ void nrn_fixed_step(neuron::model_sorted_token const& cache_token) {
         // v transfer and others do a spike exchange.
         // i.e. must complete the full multisplit time step.
         // if (!nrn_allthread_handle) {
-        nrn_multithread_job(nrn_ms_reduce_solve);
+        nrn_multisplit_reduce_solve();
         nrn_multithread_job(nrn_ms_bksub);
         /* see comment below */
         if (nrnthread_v_transfer_) {
             if (nrnmpi_v_transfer_) {
                 nrn::Instrumentor::phase p_gap("gap-v-transfer");
-                (*nrnmpi_v_transfer_)();
+                (*(nrnmpi_v_transfer_lagged_ ? nrnmpi_v_transfer_lagged_ : nrnmpi_v_transfer_))();
             }
             nrn_multithread_job(cache_token, nrn_fixed_step_lastpart);
         }
@@ -358,7 +360,7 @@ void nrn_fixed_step(neuron::model_sorted_token const& cache_token) {
         if (nrnthread_v_transfer_) {
             if (nrnmpi_v_transfer_) {
                 nrn::Instrumentor::phase p_gap("gap-v-transfer");
-                (*nrnmpi_v_transfer_)();
+                (*(nrnmpi_v_transfer_lagged_ ? nrnmpi_v_transfer_lagged_ : nrnmpi_v_transfer_))();
             }
             nrn_multithread_job(cache_token, nrn_fixed_step_lastpart);
         }
@@ -388,7 +390,7 @@ void nrn_fixed_step_group(neuron::model_sorted_token const& cache_token, int n)
         nrn_multithread_job(nrn_ms_treeset_through_triang);
         step_group_n = 0; /* abort at bksub flag */
         for (i = 1; i < n; ++i) {
-            nrn_multithread_job(nrn_ms_reduce_solve);
+            nrn_multisplit_reduce_solve();
             nrn_multithread_job(nrn_ms_bksub_through_triang);
             if (step_group_n) {
                 step_group_n = 0;
@@ -408,7 +410,7 @@ void nrn_fixed_step_group(neuron::model_sorted_token const& cache_token, int n)
             b = 0;
         }
         if (!b) {
-            nrn_multithread_job(nrn_ms_reduce_solve);
+            nrn_multisplit_reduce_solve();
             nrn_multithread_job(nrn_ms_bksub);
         }
         if (nrn_allthread_handle) {
@@ -538,10 +540,6 @@ void* nrn_ms_treeset_through_triang(NrnThread* nth) {
     CTADD;
     return nullptr;
 }
-void* nrn_ms_reduce_solve(NrnThread* nth) {
-    nrn_multisplit_reduce_solve(nth);
-    return nullptr;
-}
 void* nrn_ms_bksub(NrnThread* nth) {
     CTBEGIN;
     nrn_multisplit_bksub(nth);
@@ -93,9 +93,13 @@ namespace neuron::mechanism::_get {
 std::size_t _current_row(Prop* prop) {
     return prop ? prop->current_row() : container::invalid_row;
 }
-std::vector<double* const*> const& _pdata_ptr_cache_data(
+std::vector<double*> const& _pdata_base_data(neuron::model_sorted_token const& cache_token,
+                                             int mech_type) {
+    return cache_token.mech_cache(mech_type).pdata_base;
+}
+std::vector<std::uint32_t const*> const& _pdata_index_data(
     neuron::model_sorted_token const& cache_token,
     int mech_type) {
-    return cache_token.mech_cache(mech_type).pdata_ptr_cache;
+    return cache_token.mech_cache(mech_type).pdata_index_ptr;
 }
 }  // namespace neuron::mechanism::_get
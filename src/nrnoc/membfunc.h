@@ -7,6 +7,7 @@ extern void hoc_register_prop_size(int type, int psize, int dpsize);
 #include "options.h"  // EXTRACELLULAR
 #include "ion_semantics.h"
 
+#include <cstdint>
 #include <string>
 #include <type_traits>
 #include <vector>
@@ -288,7 +289,10 @@ template <typename>
 [[nodiscard]] int const* get_array_dims(int mech_type);
 namespace _get {
 [[nodiscard]] std::size_t _current_row(Prop*);
-[[nodiscard]] std::vector<double* const*> const& _pdata_ptr_cache_data(
+[[nodiscard]] std::vector<double*> const& _pdata_base_data(
+    neuron::model_sorted_token const& cache_token,
+    int mech_type);
+[[nodiscard]] std::vector<std::uint32_t const*> const& _pdata_index_data(
     neuron::model_sorted_token const& cache_token,
     int mech_type);
 }  // namespace _get
@@ -637,9 +637,10 @@ void nrn_thread_memblist_setup() {
     // failure, as those offsets should have a lifetime linked to the sorted
     // status of the underlying storage, i.e. they should be part of a cache
     // structure. In any case, because we have just created new Memb_list then
-    // their offsets are empty, so we need to trigger a re-sort before they are
-    // used.
-    neuron::model().apply_to_mechanisms([](auto& mech_data) { mech_data.mark_as_unsorted(); });
+    // their offsets are empty, so the cache has to be rebuilt before they are
+    // used. That sets the offsets again, but only re-sorts the mechanism data
+    // that actually changed.
+    neuron::cache::invalidate();
     nrn_fast_imem_alloc();
     free((char*) vmap);
     free((char*) mlcnt);
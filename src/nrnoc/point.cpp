@@ -95,6 +95,9 @@ void nrn_loc_point_process(int pointtype, Point_process* pnt, Section* sec, Node
                 }
             }
             v_structure_change = 1;  // needed?
+            // The instance now sorts with another Node and its cached area
+            // and ion pointers are stale.
+            neuron::model().mechanism_data(p->_type).mark_as_unsorted();
         }
         // Tell the new Node about pnt->prop
         pnt->prop->next = node->prop;
@@ -0,0 +1,33 @@
+#pragma once
+#include <cstddef>
+/**
+ * @file range_column.hpp
+ * @brief Scalar range variable resolved once for a sweep over many segments.
+ *
+ * Used by SectionList.getrange/setrange and the nrn_rangevar_*_array calls of
+ * the C API. Ordinary mechanism variables are read and written straight from
+ * their SoA column, v, i_membrane_, vext and POINTERs per segment.
+ */
+struct Section;
+struct Symbol;
+
+struct RangeColumn {
+    /// hoc_execerror unless sym is a scalar range variable, or if assign is
+    /// true and sym cannot be assigned (i_membrane_)
+    explicit RangeColumn(Symbol* sym, bool assign = false);
+    /// value at node i of sec
+    double& operator()(Section* sec, int i) const;
+    /// value at sec(x), x may be 0 or 1
+    double& operator()(Section* sec, double x) const;
+    /// call before reading values of sec; brings area and diam up to date
+    void begin_get(Section* sec) const;
+    /// call before assigning values in sec; false if they must not change
+    /// (diam when pt3dconst is set), in which case skip sec like hoc does
+    bool begin_set(Section* sec) const;
+    /// call after assigning values in sec; invalidates what depends on them
+    void end_set(Section* sec) const;
+
+    Symbol* sym;
+    double* column{};
+    std::size_t dim{1}, offset{};
+};
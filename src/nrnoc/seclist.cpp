@@ -8,6 +8,11 @@
 #include "hocparse.h"
 #include "code.h"
 #include "classreg.h"
+#include "cabcode.h"
+#include "nrn_ansi.h"
+#include "nrniv_mf.h"
+#include "range_column.hpp"
+#include "neuron/model_data.hpp"
 
 template <typename F>
 bool seclist_iterate_remove_until(List* sl, F fun, const Section* sec) {
@@ -244,6 +249,145 @@ double seclist_size(void* v) {
     return count;
 }
 
+RangeColumn::RangeColumn(Symbol* sym, bool assign)
+    : sym{sym} {
+    if (!sym || sym->type != RANGEVAR) {
+        hoc_execerror(sym ? sym->name : "symbol", "is not a range variable");
+    }
+    if (sym->arayinfo) {
+        hoc_execerror(sym->name, "is an array range variable");
+    }
+    int const type = sym->u.rng.type;
+    if (type == IMEMFAST) {
+        if (assign) {
+            hoc_execerror("i_membrane_ cannot be assigned a value", 0);
+        }
+        if (!nrn_use_fast_imem) {
+            hoc_execerror(
+                "cvode.use_fast_imem(1) has not been executed so i_membrane_ does not exist", 0);
+        }
+    }
+    if (type != VINDEX && type != IMEMFAST && type != EXTRACELL && sym->subtype != NRNPOINTER) {
+        using FloatingPoint = neuron::container::Mechanism::field::FloatingPoint;
+        auto& mech_data = neuron::model().mechanism_data(type);
+        auto const [field, array_index] = mech_data.translate_legacy_index<FloatingPoint>(
+            sym->u.rng.index);
+        column = mech_data.get_data_ptrs<FloatingPoint>()[field];
+        dim = mech_data.get_array_dims<FloatingPoint>()[field];
+        offset = array_index;
+    }
+}
+
+double& RangeColumn::operator()(Section* sec, int i) const {
+    int const type = sym->u.rng.type;
+    if (type == VINDEX) {
+        return sec->pnode[i]->v();
+    }
+    if (type == IMEMFAST) {
+        return *sec->pnode[i]->sav_rhs_handle();
+    }
+    Prop* m = nrn_mechanism_check(type, sec, i);
+    if (column && !m->ob) {
+        return column[m->id().current_row() * dim + offset];
+    }
+    return *dprop(sym, 0, sec, i);
+}
+
+double& RangeColumn::operator()(Section* sec, double x) const {
+    if (!column) {
+        // the ends of sec are nodes of their own for v and vext
+        return *nrn_rangepointer(sec, sym, x);
+    }
+    return (*this)(sec, node_index(sec, x));
+}
+
+void RangeColumn::begin_get(Section* sec) const {
+    if (sym->u.rng.type == MORPHOLOGY && sec->recalc_area_) {
+        nrn_area_ri(sec);
+    }
+}
+
+bool RangeColumn::begin_set(Section* sec) const {
+    if (sym->u.rng.type == MORPHOLOGY) {
+        if (!can_change_morph(sec)) {
+            return false;
+        }
+        diam_changed = 1;
+    }
+    return true;
+}
+
+void RangeColumn::end_set(Section* sec) const {
+    if (sym->u.rng.type == MORPHOLOGY) {
+        sec->recalc_area_ = 1;
+        nrn_diam_change(sec);
+    }
+#if EXTRACELLULAR
+    if (sym->u.rng.type == EXTRACELL && sym->u.rng.index == 0) {
+        diam_changed = 1;
+    }
+#endif
+}
+
+/* vec = sl.getrange("name" [, vec]) values of name at every segment,
+   sections in list order.
+*/
+static Object** getrange(void* v) {
+    List* sl = static_cast<List*>(v);
+    RangeColumn const rv{hoc_lookup(gargstr(1))};
+    std::size_t n = 0;
+    seclist_iterate_remove(sl, [&](Section* sec) {
+        rv.begin_get(sec);
+        n += sec->nnode - 1;
+    });
+    IvocVect* vec = ifarg(2) ? vector_arg(2) : vector_new1(0);
+    vector_resize(vec, n);
+    double* px = vector_vec(vec);
+    seclist_iterate_remove(sl, [&](Section* sec) {
+        for (int i = 0; i < sec->nnode - 1; ++i) {
+            *px++ = rv(sec, i);
+        }
+    });
+    return vector_pobj(vec);
+}
+
+/* n = sl.setrange("name", vec or scalar) assigns name at every segment,
+   returns the number of segments.
+*/
+static double setrange(void* v) {
+    List* sl = static_cast<List*>(v);
+    RangeColumn const rv{hoc_lookup(gargstr(1)), true};
+    double const* px = nullptr;
+    double x = 0.;
+    std::size_t n = 0;
+    seclist_iterate_remove(sl, [&](Section* sec) { n += sec->nnode - 1; });
+    if (hoc_is_double_arg(2)) {
+        x = *getarg(2);
+    } else {
+        IvocVect* vec = vector_arg(2);
+        if (std::size_t(vector_capacity(vec)) != n) {
+            hoc_execerr_ext("Vector size %d is not the number of segments %zu",
+                            vector_capacity(vec),
+                            n);
+        }
+        px = vector_vec(vec);
+    }
+    hoc_return_type_code = HocReturnType::integer;
+    seclist_iterate_remove(sl, [&](Section* sec) {
+        if (!rv.begin_set(sec)) {
+            if (px) {
+                px += sec->nnode - 1;
+            }
+            return;
+        }
+        for (int i = 0; i < sec->nnode - 1; ++i) {
+            rv(sec, i) = px ? *px++ : x;
+        }
+        rv.end_set(sec);
+    });
+    return double(n);
+}
+
 static Member_func members[] = {{"append", append},
                                 {"remove", seclist_remove},
                                 {"wholetree", wholetree},
@@ -254,11 +398,14 @@ static Member_func members[] = {{"append", append},
                                 {"contains", contains},
                                 {"allroots", allroots},
                                 {"size", seclist_size},
+                                {"setrange", setrange},
                                 {nullptr, nullptr}};
 
+static Member_ret_obj_func retobj_members[] = {{"getrange", getrange}, {nullptr, nullptr}};
+
 void SectionList_reg(void) {
     /*	printf("SectionList_reg\n");*/
-    class2oc("SectionList", constructor, destructor, members, nullptr, nullptr);
+    class2oc("SectionList", constructor, destructor, members, retobj_members, nullptr);
 }
 
 #define relative(pc) (pc + (pc)->i)
@@ -28,7 +28,9 @@
 #include <cmath>
 
 #include <algorithm>
+#include <chrono>
 #include <string>
+#include <utility>
 
 #include <fmt/format.h>
 
@@ -2077,8 +2079,9 @@ void nrn_fill_mech_data_caches(neuron::cache::Model& cache,
     // For example, when a mechanism uses an ion then one of its pdata fields holds Datum
     // (=generic_data_handle) objects that wrap data_handles to ion (RANGE) variables.
     // Dereferencing those fields to access the relevant double values can be indirect and
-    // expensive, so here we can generate a std::vector<double*> that can be used directly in
-    // hot loops. This is partitioned for the threads in the same way as the other data.
+    // expensive, so here we generate, per field, the start of the column those handles refer to
+    // and a flat vector of 32 bit offsets into it that can be used directly in hot loops. This is
+    // partitioned for the threads in the same way as the other data.
     // Note that this needs to come after *all* of the mechanism types' data have been permuted, not
     // just the type that we are filling the cache for.
     // TODO could identify the case that the pointers are all monotonically increasing and optimise
@@ -2088,26 +2091,43 @@ void nrn_fill_mech_data_caches(neuron::cache::Model& cache,
     // sorted
     if (type != MORPHOLOGY) {
         auto& mech_cache = cache.mechanism.at(type);
-        // Transform the vector<Datum> in pdata_hack into vector<double*> in pdata
-        std::transform(mech_cache.pdata_hack.begin(),
-                       mech_cache.pdata_hack.end(),
-                       std::back_inserter(mech_cache.pdata),
-                       [](std::vector<Datum*>& pdata_hack) {
-                           std::vector<double*> tmp{};
-                           std::transform(pdata_hack.begin(),
-                                          pdata_hack.end(),
-                                          std::back_inserter(tmp),
-                                          [](Datum* datum) { return datum->get<double*>(); });
-                           pdata_hack.clear();
-                           pdata_hack.shrink_to_fit();
-                           return tmp;
-                       });
-        mech_cache.pdata_hack.clear();
-        // Create a flat list of pointers we can use inside generated code
-        std::transform(mech_cache.pdata.begin(),
-                       mech_cache.pdata.end(),
-                       std::back_inserter(mech_cache.pdata_ptr_cache),
-                       [](auto const& pdata) { return pdata.empty() ? nullptr : pdata.data(); });
+        auto& pdata_hack = mech_cache.pdata_hack;
+        // Each cached field has one entry per instance, other fields have none
+        std::size_t ninstances{}, ncached{};
+        for (auto const& datums: pdata_hack) {
+            ninstances = std::max(ninstances, datums.size());
+            ncached += !datums.empty();
+        }
+        mech_cache.pdata_base.assign(pdata_hack.size(), nullptr);
+        mech_cache.pdata_index_ptr.assign(pdata_hack.size(), nullptr);
+        mech_cache.pdata_index.resize(ncached * ninstances);
+        auto* index = mech_cache.pdata_index.data();
+        for (std::size_t field = 0; field < pdata_hack.size(); ++field) {
+            auto& datums = pdata_hack[field];
+            if (datums.empty()) {
+                continue;
+            }
+            // All the instances of one field refer to the same column
+            auto* const base =
+                static_cast<neuron::container::data_handle<double>>(*datums.front()).column_data();
+            mech_cache.pdata_base[field] = base;
+            mech_cache.pdata_index_ptr[field] = index;
+            for (Datum* datum: datums) {
+                auto const handle = static_cast<neuron::container::data_handle<double>>(*datum);
+                auto* const ptr = datum->get<double*>();
+                if (!base || handle.column_data() != base ||
+                    std::size_t(ptr - base) > std::numeric_limits<std::uint32_t>::max()) {
+                    std::ostringstream oss;
+                    oss << "pdata field " << field << " of " << mech_data.name()
+                        << " does not refer to a single column of model data";
+                    throw std::runtime_error(oss.str());
+                }
+                *index++ = ptr - base;
+            }
+            datums.clear();
+            datums.shrink_to_fit();
+        }
+        pdata_hack.clear();
     }
 }
 
@@ -2173,6 +2193,64 @@ static void nrn_sort_node_data(neuron::container::Node::storage::frozen_token_ty
     node_data.apply_reverse_permutation(std::move(node_data_permutation), sorted_token);
 }
 
+namespace {
+/**
+ * @brief Decide which mechanism types can keep their entries from the stale cache.
+ *
+ * After small structural edits, such as adding a point process, most mechanism
+ * types have neither gained nor lost instances. If in addition the Node data
+ * did not move, their data are still partitioned by NrnThread in the same way
+ * and the pointers in their pdata caches are still valid, provided the data
+ * those pointers refer to (ion variables, diam) did not move either.
+ */
+std::vector<bool> reusable_mechanism_caches(neuron::cache::Model const& stale,
+                                            std::vector<std::size_t> const& layout_generation) {
+    auto const ntype = layout_generation.size();
+    std::vector<bool> reuse(ntype);
+    if (stale.thread.size() != std::size_t(nrn_nthread)) {
+        return reuse;
+    }
+    for (std::size_t type = 0; type < ntype; ++type) {
+        if (type >= stale.mechanism.size() || nrn_is_artificial_[type] ||
+            stale.mechanism[type].layout_generation != layout_generation[type]) {
+            continue;
+        }
+        // The per-thread offsets in the stale cache must still describe the
+        // per-thread instance counts.
+        bool ok{true};
+        for (int it = 0; ok && it < nrn_nthread; ++it) {
+            auto* const ml = nrn_threads[it]._ml_list[type];
+            std::size_t const count = ml ? ml->nodecount : 0;
+            auto const begin = stale.thread[it].mechanism_offset.at(type);
+            auto const end = it + 1 < nrn_nthread ? stale.thread[it + 1].mechanism_offset.at(type)
+                                                  : begin + count;
+            ok = end - begin == count;
+        }
+        reuse[type] = ok;
+    }
+    // A cached pointer is only valid if its target did not move.
+    for (bool changed = true; changed;) {
+        changed = false;
+        for (std::size_t type = 0; type < ntype; ++type) {
+            if (!reuse[type] || type == MORPHOLOGY) {
+                continue;
+            }
+            neuron::cache::indices_to_cache(type, [&](auto field) {
+                auto const sem = memb_func[type].dparam_semantics[field];
+                int const target = sem == -9                   ? MORPHOLOGY
+                                   : nrn_semantics_is_ion(sem) ? nrn_semantics_ion_type(sem)
+                                                               : -1;
+                if (target >= 0 && !reuse[target]) {
+                    reuse[type] = false;
+                    changed = true;
+                }
+            });
+        }
+    }
+    return reuse;
+}
+}  // namespace
+
 /**
  * @brief Ensure neuron::container::* data are sorted.
  *
@@ -2208,27 +2286,33 @@ neuron::model_sorted_token nrn_ensure_model_data_are_sorted() {
     auto const mech_storage_size = model.mechanism_storage_size();
     std::vector<neuron::container::Mechanism::storage::frozen_token_type> mech_tokens{};
     mech_tokens.reserve(mech_storage_size);
-    model.apply_to_mechanisms([&already_sorted, &mech_tokens](auto& mech_data) {
+    std::vector<std::size_t> mech_layout_generation(mech_storage_size);
+    model.apply_to_mechanisms([&already_sorted, &mech_tokens, &mech_layout_generation](
+                                  auto& mech_data) {
         mech_tokens.push_back(mech_data.issue_frozen_token());
+        mech_layout_generation[mech_data.type()] = mech_data.layout_generation();
         already_sorted = already_sorted && mech_data.is_sorted();
     });
     // Now the whole model is marked frozen/read-only, but it may or may not be
     // marked sorted (if it is, the cache should be valid, otherwise it should
-    // not be).
-    if (already_sorted) {
-        // If everything was already sorted, the cache should already be valid.
-        assert(neuron::cache::model);
+    // not be). The cache can also have been invalidated without any data
+    // being marked unsorted, e.g. when the Memb_list were rebuilt.
+    if (already_sorted && neuron::cache::model) {
         // There isn't any more work to be done, really.
     } else {
-        // Some part of the model data is not already marked sorted. In this
-        // case we expect that the cache is *not* valid, because whatever
-        // caused something to not be sorted should also have invalidated the
-        // cache.
+        // Whatever caused something to not be sorted should also have
+        // invalidated the cache.
         assert(!neuron::cache::model);
+        auto const start = std::chrono::steady_clock::now();
+        // The previous cache, if any; entries that are still valid are moved
+        // from here into the new cache instead of being recomputed.
+        auto stale = std::exchange(neuron::cache::stale_model, std::nullopt);
         // Build a new cache (*not* in situ, so it doesn't get invalidated
         // under our feet while we're in the middle of the job) and populate it
         // by calling the various methods that sort the model data.
+        static std::size_t s_cache_generation{};
         neuron::cache::Model cache{};
+        cache.generation = ++s_cache_generation;
         cache.thread.resize(nrn_nthread);
         for (auto& thread_cache: cache.thread) {
             thread_cache.mechanism_offset.resize(mech_storage_size);
@@ -2245,17 +2329,62 @@ neuron::model_sorted_token nrn_ensure_model_data_are_sorted() {
         // an elevated "write lock" status.
         nrn_sort_node_data(node_token, cache);
         assert(node_data.is_sorted());
+        cache.node_layout_generation = node_data.layout_generation();
+        // If no Node moved, mechanism types whose rows did not move either
+        // keep their order and their cache entries. Otherwise all the
+        // mechanism data are sorted again and all the caches rebuilt.
+        bool const nodes_changed = !stale ||
+                                   stale->node_layout_generation != cache.node_layout_generation ||
+                                   stale->thread.size() != cache.thread.size() ||
+                                   std::any_of(cache.thread.begin(),
+                                               cache.thread.end(),
+                                               [&stale, &cache](auto const& thread_cache) {
+                                                   auto const i = &thread_cache -
+                                                                  cache.thread.data();
+                                                   return thread_cache.node_data_offset !=
+                                                          stale->thread[i].node_data_offset;
+                                               });
+        auto const reuse = nodes_changed
+                               ? std::vector<bool>(mech_storage_size)
+                               : reusable_mechanism_caches(*stale, mech_layout_generation);
+        neuron::cache::SortStats stats{};
+        stats.nodes = nodes_changed;
         // TODO: maybe we should separate out cache population from sorting.
         std::size_t n{};
-        model.apply_to_mechanisms([&cache, &n, &mech_tokens](auto& mech_data) {
-            // TODO do we need to pass `node_token` to `nrn_sort_mech_data`?
-            nrn_sort_mech_data(mech_tokens[n], cache, mech_data);
+        model.apply_to_mechanisms([&](auto& mech_data) {
+            auto const type = mech_data.type();
+            if (reuse[type]) {
+                for (NrnThread* nt: for_threads(nrn_threads, nrn_nthread)) {
+                    auto const offset = stale->thread[nt->id].mechanism_offset[type];
+                    cache.thread[nt->id].mechanism_offset[type] = offset;
+                    if (auto* const ml = nt->_ml_list[type]; ml) {
+                        ml->set_storage_offset(offset);
+                    }
+                }
+                // Moving the vectors keeps the buffer pdata_index_ptr points into.
+                cache.mechanism[type] = std::move(stale->mechanism[type]);
+                mech_data.mark_as_sorted(mech_tokens[n]);
+                ++stats.mechanisms_reused;
+            } else {
+                // TODO do we need to pass `node_token` to `nrn_sort_mech_data`?
+                nrn_sort_mech_data(mech_tokens[n], cache, mech_data);
+                ++stats.mechanisms_sorted;
+            }
             assert(mech_data.is_sorted());
             ++n;
         });
         // Now that all the mechanism data is sorted we can fill in pdata caches
-        model.apply_to_mechanisms(
-            [&cache](auto& mech_data) { nrn_fill_mech_data_caches(cache, mech_data); });
+        model.apply_to_mechanisms([&cache, &reuse](auto& mech_data) {
+            auto const type = mech_data.type();
+            if (!reuse[type]) {
+                nrn_fill_mech_data_caches(cache, mech_data);
+            }
+            cache.mechanism[type].layout_generation = mech_data.layout_generation();
+        });
+        stats.seconds =
+            std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        stats.generation = cache.generation;
+        neuron::cache::last_sort = stats;
         // Move our working cache into the global storage.
         neuron::cache::model = std::move(cache);
     }
@@ -10,6 +10,7 @@ a linked list of Grid_nodes
 #include "nrnpython.h"
 #include "grids.h"
 #include "rxd.h"
+#include "oc_ansi.h"
 
 extern int NUM_THREADS;
 double* dt_ptr;
@@ -95,6 +96,9 @@ ECS_Grid_node::ECS_Grid_node(PyHocObject* my_states,
 
     next = NULL;
     VARIABLE_ECS_VOLUME = FALSE;
+    ecs_solver = ECS_SOLVER_ADI;
+    multigrid = NULL;
+    decomposition = NULL;
 
     /*Check to see if variable tortuosity/volume fraction is used*/
     if (PyFloat_Check(my_permeability)) {
@@ -159,7 +163,8 @@ ECS_Grid_node::ECS_Grid_node(PyHocObject* my_states,
     ecs_tasks = (ECSAdiGridData*) malloc(NUM_THREADS * sizeof(ECSAdiGridData));
     for (k = 0; k < NUM_THREADS; k++) {
         ecs_tasks[k].scratchpad = (double*) malloc(
-            sizeof(double) * MAX(my_num_states_x, MAX(my_num_states_y, my_num_states_z)));
+            sizeof(double) *
+            ECS_ADI_SCRATCHPAD(MAX(my_num_states_x, MAX(my_num_states_y, my_num_states_z))));
         ecs_tasks[k].g = this;
     }
 
@@ -168,18 +173,24 @@ ECS_Grid_node::ECS_Grid_node(PyHocObject* my_states,
     ecs_adi_dir_x->states_in = states;
     ecs_adi_dir_x->states_out = states_x;
     ecs_adi_dir_x->line_size = my_num_states_x;
+    ecs_adi_dir_x->ecs_dg_adi_dir = NULL;
+    ecs_adi_dir_x->ecs_dg_adi_rhs = NULL;
 
 
     ecs_adi_dir_y = (ECSAdiDirection*) malloc(sizeof(ECSAdiDirection));
     ecs_adi_dir_y->states_in = states_x;
     ecs_adi_dir_y->states_out = states_y;
     ecs_adi_dir_y->line_size = my_num_states_y;
+    ecs_adi_dir_y->ecs_dg_adi_dir = NULL;
+    ecs_adi_dir_y->ecs_dg_adi_rhs = NULL;
 
 
     ecs_adi_dir_z = (ECSAdiDirection*) malloc(sizeof(ECSAdiDirection));
     ecs_adi_dir_z->states_in = states_y;
     ecs_adi_dir_z->states_out = states_x;
     ecs_adi_dir_z->line_size = my_num_states_z;
+    ecs_adi_dir_z->ecs_dg_adi_dir = NULL;
+    ecs_adi_dir_z->ecs_dg_adi_rhs = NULL;
 
     this->atolscale = atolscale;
 
@@ -531,6 +542,39 @@ extern "C" NRN_EXPORT int set_volume_fraction(int grid_list_index,
     return 0;
 }
 
+extern "C" NRN_EXPORT int set_ecs_solver(int grid_list_index, int grid_id, int solver) {
+    int id = 0;
+    Grid_node* node = Parallel_grids[grid_list_index];
+    while (id < grid_id) {
+        node = node->next;
+        id++;
+        if (node == NULL)
+            return -1;
+    }
+    static_cast<ECS_Grid_node*>(node)->set_solver(solver);
+    return 0;
+}
+
+/* split the grid between the ranks, returns -1 if it cannot be decomposed */
+extern "C" NRN_EXPORT int set_ecs_decomposition(int grid_list_index, int grid_id) {
+    int id = 0;
+    Grid_node* node = Parallel_grids[grid_list_index];
+    while (id < grid_id) {
+        node = node->next;
+        id++;
+        if (node == NULL)
+            return -1;
+    }
+    return ecs_decomposition_create(static_cast<ECS_Grid_node*>(node));
+}
+
+void ECS_Grid_node::set_solver(int solver) {
+    ecs_solver = solver;
+    /* the hierarchy is rebuilt on the next solve */
+    ecs_multigrid_free(multigrid);
+    multigrid = NULL;
+}
+
 void ECS_Grid_node::set_volume_fraction(PyHocObject* my_alpha) {
     if (PyFloat_Check(my_alpha)) {
         if (get_alpha == &get_alpha_scalar) {
@@ -677,6 +721,10 @@ extern "C" NRN_EXPORT void set_grid_concentrations(int grid_list_index,
         g->concentration_list[i].destination =
             reinterpret_cast<PyHocObject*>(PyList_GET_ITEM(neuron_pointers, i))->u.px_;
     }
+    ECS_Grid_node* eg = dynamic_cast<ECS_Grid_node*>(g);
+    if (eg && eg->decomposition) {
+        ecs_decomposition_set_concentrations(eg);
+    }
 }
 
 /* TODO: make this work with Grid_node ptrs instead of pairs of list indices */
@@ -732,7 +780,14 @@ extern "C" NRN_EXPORT void set_grid_currents(int grid_list_index,
      PyErr_Clear(); */
 
 #if NRNMPI
-    if (nrnmpi_use) {
+    ECS_Grid_node* eg = dynamic_cast<ECS_Grid_node*>(g);
+    if (eg && eg->decomposition) {
+        /*Currents are only sent to the ranks that own their voxels*/
+        free(g->all_currents);
+        g->all_currents = (double*) malloc(sizeof(double) * g->num_currents);
+        g->num_all_currents = g->num_currents;
+        ecs_decomposition_set_currents(eg);
+    } else if (nrnmpi_use) {
         /*Gather an array of the number of currents for each process*/
         g->proc_num_currents[nrnmpi_myid] = n;
         nrnmpi_int_allgather_inplace(g->proc_num_currents, 1);
@@ -841,8 +896,8 @@ void ECS_Grid_node::set_num_threads(const int n) {
     free(ecs_tasks);
     ecs_tasks = (ECSAdiGridData*) malloc(n * sizeof(ECSAdiGridData));
     for (i = 0; i < n; i++) {
-        ecs_tasks[i].scratchpad = (double*) malloc(sizeof(double) *
-                                                   MAX(size_x, MAX(size_y, size_z)));
+        ecs_tasks[i].scratchpad = (double*) malloc(
+            sizeof(double) * ECS_ADI_SCRATCHPAD(MAX(size_x, MAX(size_y, size_z))));
         ecs_tasks[i].g = this;
     }
 }
@@ -886,7 +941,7 @@ void ECS_Grid_node::do_grid_currents(double* output, double dt, int grid_id) {
     m = num_currents;
     CurrentData* tasks = (CurrentData*) malloc(NUM_THREADS * sizeof(CurrentData));
 #if NRNMPI
-    val = all_currents + (nrnmpi_use ? proc_offsets[nrnmpi_myid] : 0);
+    val = all_currents + (nrnmpi_use && !decomposition ? proc_offsets[nrnmpi_myid] : 0);
 #else
     val = all_currents;
 #endif
@@ -908,7 +963,12 @@ void ECS_Grid_node::do_grid_currents(double* output, double dt, int grid_id) {
     TaskQueue_sync(AllTasks);
     free(tasks);
 #if NRNMPI
-    if (nrnmpi_use) {
+    if (decomposition) {
+        nrnmpi_dbl_allgatherv_inplace(induced_currents,
+                                      proc_induced_current_count,
+                                      proc_induced_current_offset);
+        ecs_decomposition_currents(this, all_currents, output, dt);
+    } else if (nrnmpi_use) {
         nrnmpi_dbl_allgatherv_inplace(all_currents, proc_num_currents, proc_offsets);
         nrnmpi_dbl_allgatherv_inplace(induced_currents,
                                       proc_induced_current_count,
@@ -1007,8 +1067,48 @@ void ECS_Grid_node::volume_setup() {
     }
 }
 
+/* Multigrid stops after a fixed number of iterations, e.g. for an ill
+ * conditioned system. Warn once and let the caller fall back. */
+static void ecs_multigrid_not_converged(const char* fallback) {
+    static bool warned = false;
+    if (!warned) {
+        warned = true;
+        hoc_warning("rxd multigrid solver did not converge,", fallback);
+    }
+}
+
 int ECS_Grid_node::dg_adi() {
     unsigned long i;
+    if (decomposition) {
+        if (diffusable) {
+            ecs_decomposition_dg_adi(this);
+        } else {
+            for (i = 0; i < size_x * size_y * size_z; i++)
+                states[i] += states_cur[i];
+        }
+        ecs_decomposition_readout(this, states);
+        return 0;
+    }
+    if (diffusable && ecs_solver == ECS_SOLVER_MULTIGRID && !VARIABLE_ECS_VOLUME) {
+        /* backward Euler, (I - dt L) states = states + currents */
+        for (i = 0; i < size_x * size_y * size_z; i++)
+            states_x[i] = states[i] + states_cur[i];
+        if (bc->type == DIRICHLET) {
+            for (int x = 0; x < size_x; x++)
+                for (int y = 0; y < size_y; y++)
+                    for (int z = 0; z < size_z; z++)
+                        if (x == 0 || y == 0 || z == 0 || x == size_x - 1 || y == size_y - 1 ||
+                            z == size_z - 1)
+                            states_x[(x * size_y + y) * size_z + z] = bc->value;
+        }
+        /* keep the old states in case multigrid does not converge */
+        memcpy(states_y, states, sizeof(double) * size_x * size_y * size_z);
+        if (ecs_multigrid_solve(this, *dt_ptr, states_x, states) >= 0) {
+            return 0;
+        }
+        ecs_multigrid_not_converged("ADI is used for this step");
+        memcpy(states, states_y, sizeof(double) * size_x * size_y * size_z);
+    }
     if (diffusable) {
         /* first step: advance the x direction */
         ecs_run_threaded_dg_adi(size_y, size_z, this, ecs_adi_dir_x, size_x);
@@ -1035,6 +1135,10 @@ int ECS_Grid_node::dg_adi() {
 }
 
 void ECS_Grid_node::variable_step_diffusion(const double* states, double* ydot) {
+    if (decomposition) {
+        ecs_decomposition_rhs(this, ydot);
+        return;
+    }
     switch (VARIABLE_ECS_VOLUME) {
     case VOLUME_FRACTION:
         _rhs_variable_step_helper_vol(this, states, ydot);
@@ -1241,7 +1345,18 @@ void ECS_Grid_node::do_multicompartment_reactions(double* result) {
 }
 
 // TODO: Implement this
-void ECS_Grid_node::variable_step_ode_solve(double*, double) {}
+/* with the multigrid solver the CVODE preconditioner solves the diffusion
+ * part of the Jacobian, otherwise it is approximated by the identity */
+void ECS_Grid_node::variable_step_ode_solve(double* RHS, double dt) {
+    if (diffusable && ecs_solver == ECS_SOLVER_MULTIGRID && !VARIABLE_ECS_VOLUME) {
+        /* states_y is free during variable step, ADI is not used */
+        memcpy(states_y, RHS, sizeof(double) * size_x * size_y * size_z);
+        if (ecs_multigrid_solve(this, dt, RHS, RHS) < 0) {
+            ecs_multigrid_not_converged("the identity preconditioner is used");
+            memcpy(RHS, states_y, sizeof(double) * size_x * size_y * size_z);
+        }
+    }
+}
 
 // Free a single Grid_node
 ECS_Grid_node::~ECS_Grid_node() {
@@ -1267,6 +1382,8 @@ ECS_Grid_node::~ECS_Grid_node() {
     free(ecs_adi_dir_x);
     free(ecs_adi_dir_y);
     free(ecs_adi_dir_z);
+    ecs_multigrid_free(multigrid);
+    ecs_decomposition_free(decomposition);
     if (node_flux_count > 0) {
         free(node_flux_idx);
         free(node_flux_scale);
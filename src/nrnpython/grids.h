@@ -28,6 +28,22 @@ and Flux_pair structs and their respective functions
 #define NEUMANN   0
 #define DIRICHLET 1
 
+/* lines solved together by the homogeneous ECS DG-ADI, and the scratchpad
+ * each thread needs for lines of length n (factors plus one batch) */
+#define ECS_ADI_LANES         8
+#define ECS_ADI_SCRATCHPAD(n) ((3 + ECS_ADI_LANES) * (n))
+
+/* voxels evaluated together by a batched extracellular reaction kernel */
+#define ECS_REACTION_BATCH 64
+
+/* implicit solvers for homogeneous extracellular diffusion */
+#define ECS_SOLVER_ADI       0
+#define ECS_SOLVER_MULTIGRID 1
+struct ECSMultigrid;
+
+/* slab decomposition of an extracellular grid over the MPI ranks */
+struct ECSDecomposition;
+
 #define MAX(a, b) ((a) > (b) ? (a) : (b))
 #define MIN(a, b) ((a) < (b) ? (a) : (b))
 
@@ -56,9 +72,13 @@ struct Current_Triple {
 using ReactionRate =
     void(double**, double**, double**, double*, double*, double*, double*, double**, double);
 using ECSReactionRate = void(double*, double*, double*, double*);
+/* evaluates a reaction at n voxels, species j of voxel c is species[j * n + c]
+ * and likewise for the parameters and the rates */
+using ECSReactionBatch = void(int, const double*, const double*, double*);
 struct Reaction {
     Reaction* next;
     ECSReactionRate* reaction;
+    ECSReactionBatch* reaction_batch;  // NULL if the reaction is only per voxel
     unsigned int num_species_involved;
     unsigned int num_params_involved;
     double** species_states;
@@ -66,6 +86,8 @@ struct Reaction {
     unsigned int region_size;
     uint64_t* mc3d_indices_offsets;
     double** mc3d_mults;
+    /* the voxels advanced by this rank, all of them unless the grid is decomposed */
+    unsigned int owned_start, owned_stop;
 };
 
 struct AdiLineData {
@@ -182,6 +204,10 @@ class ECS_Grid_node: public Grid_node {
     struct ECSAdiDirection* ecs_adi_dir_x;
     struct ECSAdiDirection* ecs_adi_dir_y;
     struct ECSAdiDirection* ecs_adi_dir_z;
+    // ECS_SOLVER_ADI or ECS_SOLVER_MULTIGRID, the latter only for homogeneous grids
+    unsigned char ecs_solver;
+    struct ECSMultigrid* multigrid;  // created by the first multigrid solve
+    struct ECSDecomposition* decomposition;  // NULL unless split between ranks
 
     // Data for multicompartment reactions
     int induced_idx;
@@ -218,6 +244,7 @@ class ECS_Grid_node: public Grid_node {
     void set_diffusion(double*, int);
     void set_tortuosity(PyHocObject*);
     void set_volume_fraction(PyHocObject*);
+    void set_solver(int);
     void do_multicompartment_reactions(double*);
     void initialize_multicompartment_reaction();
     void clear_multicompartment_reaction();
@@ -233,6 +260,14 @@ struct ECSAdiDirection {
                            double const* const,
                            double* const,
                            double* const);
+    /* homogeneous grids only build the right hand side of each line, returning
+     * 1 if it needs the tridiagonal solve, and the lines are solved in batches */
+    int (*ecs_dg_adi_rhs)(ECS_Grid_node*,
+                          const double,
+                          const int,
+                          const int,
+                          double const* const,
+                          double* const);
     double* states_in;
     double* states_out;
     int line_size;
@@ -244,6 +279,7 @@ struct ECSAdiGridData {
     ECS_Grid_node* g;
     int sizej;
     ECSAdiDirection* ecs_adi_dir;
+    /* ECS_ADI_SCRATCHPAD(n) doubles for lines of length n */
     double* scratchpad;
 };
 
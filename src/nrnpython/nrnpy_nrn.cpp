@@ -12,6 +12,7 @@
 #include "nrnpy_utils.h"
 #include "convert_cxx_exceptions.hpp"
 #include "neuron/unique_cstr.hpp"
+#include "neuron/model_data.hpp"
 
 #ifndef M_PI
 #define M_PI (3.14159265358979323846)
@@ -108,6 +109,22 @@ struct NPyOpaquePointer {
     PyObject_HEAD
 };
 
+// Zero-copy view of one floating point column of the model data. Valid only
+// as long as the layout generation and base pointer of the storage match the
+// values recorded when it was made. Each ndarray made from it pins the storage
+// until the column, their base, is deallocated.
+struct NPyColumn {
+    PyObject_HEAD
+    int type_;  // mechanism type, VINDEX for the Node voltage column
+    int field_;
+    int writable_;
+    double* data_;
+    std::size_t size_;
+    std::size_t array_dim_;
+    std::size_t generation_;
+    std::size_t pins_;
+};
+
 PyTypeObject* psection_type;
 static PyTypeObject* pallseg_of_sec_iter_type;
 static PyTypeObject* pseg_of_sec_iter_type;
@@ -118,6 +135,7 @@ static PyTypeObject* pmechfunc_generic_type;
 static PyTypeObject* pvar_of_mech_iter_generic_type;
 static PyTypeObject* range_type;
 static PyTypeObject* opaque_pointer_type;
+static PyTypeObject* column_type;
 
 PyObject* pmech_types;  // Python map for name to Mechanism
 PyObject* rangevars_;   // Python map for name to Symbol
@@ -1069,6 +1087,183 @@ static PyObject* newpyseghelp(Section* sec, double x) {
     return (PyObject*) seg;
 }
 
+static const char* column_stale_msg =
+    "nrn.Column is stale: the model data were reallocated or permuted, call nrn.column again";
+
+static bool column_valid(const NPyColumn* self) {
+    auto& model = neuron::model();
+    if (self->type_ == VINDEX) {
+        auto& node_data = model.node_data();
+        return node_data.layout_generation() == self->generation_ &&
+               node_data.get_data_ptrs<neuron::container::Node::field::Voltage>()[0] ==
+                   self->data_;
+    }
+    if (!model.is_valid_mechanism(self->type_)) {
+        return false;
+    }
+    using FloatingPoint = neuron::container::Mechanism::field::FloatingPoint;
+    auto& mech_data = model.mechanism_data(self->type_);
+    return mech_data.layout_generation() == self->generation_ &&
+           mech_data.get_data_ptrs<FloatingPoint>()[self->field_] == self->data_;
+}
+
+static void column_pin(const NPyColumn* self, bool pin) {
+    auto& model = neuron::model();
+    auto apply = [pin](auto& storage) {
+        if (pin) {
+            storage.pin_storage();
+        } else {
+            storage.unpin_storage();
+        }
+    };
+    if (self->type_ == VINDEX) {
+        apply(model.node_data());
+    } else if (model.is_valid_mechanism(self->type_)) {
+        apply(model.mechanism_data(self->type_));
+    }
+}
+
+// nrn.column(name, writable=False) views the storage of a range variable for
+// every instance of its mechanism (or every node for v), in the permuted
+// order used by the simulation.
+static PyObject* nrnpy_column(PyObject* self, PyObject* args) {
+    char* name;
+    int writable = 0;
+    if (!PyArg_ParseTuple(args, "s|p", &name, &writable)) {
+        return NULL;
+    }
+    Symbol* sym = hoc_lookup(name);
+    if (!sym || sym->type != RANGEVAR) {
+        PyErr_Format(PyExc_ValueError, "%s is not a range variable", name);
+        return NULL;
+    }
+    int const type = sym->u.rng.type;
+    if (type == IMEMFAST || type == EXTRACELL || sym->subtype == NRNPOINTER) {
+        PyErr_Format(PyExc_ValueError, "%s has no column in the model data", name);
+        return NULL;
+    }
+    // the column is handed out in the order the next simulation will use
+    { auto const sorted_token = nrn_ensure_model_data_are_sorted(); }
+    auto* col = PyObject_New(NPyColumn, column_type);
+    if (col == NULL) {
+        return NULL;
+    }
+    col->type_ = type;
+    col->writable_ = writable;
+    col->pins_ = 0;
+    auto& model = neuron::model();
+    if (type == VINDEX) {
+        auto& node_data = model.node_data();
+        col->field_ = 0;
+        col->data_ = node_data.get_data_ptrs<neuron::container::Node::field::Voltage>()[0];
+        col->size_ = node_data.size();
+        col->array_dim_ = 1;
+        col->generation_ = node_data.layout_generation();
+    } else {
+        using FloatingPoint = neuron::container::Mechanism::field::FloatingPoint;
+        auto& mech_data = model.mechanism_data(type);
+        col->field_ = mech_data.translate_legacy_index<FloatingPoint>(sym->u.rng.index).field;
+        col->data_ = mech_data.get_data_ptrs<FloatingPoint>()[col->field_];
+        col->size_ = mech_data.size();
+        col->array_dim_ = mech_data.get_array_dims<FloatingPoint>()[col->field_];
+        col->generation_ = mech_data.layout_generation();
+    }
+    return (PyObject*) col;
+}
+
+static PyObject* nrnpy_column_safe(PyObject* self, PyObject* args) {
+    return nrn::convert_cxx_exceptions(nrnpy_column, self, args);
+}
+
+static void NPyColumn_dealloc(NPyColumn* self) {
+    for (; self->pins_; --self->pins_) {
+        column_pin(self, false);
+    }
+    ((PyObject*) self)->ob_type->tp_free((PyObject*) self);
+}
+
+static PyObject* NPyColumn_valid(NPyColumn* self) {
+    return PyBool_FromLong(column_valid(self));
+}
+
+static PyObject* NPyColumn_valid_safe(NPyColumn* self) {
+    return nrn::convert_cxx_exceptions(NPyColumn_valid, self);
+}
+
+// The segment of each row of the column, None for rows without one.
+static PyObject* NPyColumn_segments(NPyColumn* self) {
+    if (!column_valid(self)) {
+        PyErr_SetString(PyExc_RuntimeError, column_stale_msg);
+        return NULL;
+    }
+    auto result = nb::steal(PyList_New(self->size_));
+    for (std::size_t i = 0; i < self->size_; ++i) {
+        Py_INCREF(Py_None);
+        PyList_SET_ITEM(result.ptr(), i, Py_None);
+    }
+    auto set = [&](std::size_t row, Section* sec, Node* nd) {
+        PyList_SetItem(result.ptr(), row, newpyseghelp(sec, nrn_arc_position(sec, nd)));
+    };
+    hoc_Item* qsec;
+    ITERATE(qsec, section_list) {
+        Section* sec = hocSEC(qsec);
+        if (self->type_ == VINDEX) {
+            for (int i = 0; i < sec->nnode; ++i) {
+                set(sec->pnode[i]->id().current_row(), sec, sec->pnode[i]);
+            }
+            if (!sec->parentsec && sec->parentnode) {
+                set(sec->parentnode->id().current_row(), sec, sec->parentnode);
+            }
+        } else {
+            for (int i = 0; i < sec->nnode - 1; ++i) {
+                if (Prop* p = nrn_mechanism(self->type_, sec->pnode[i])) {
+                    set(p->id().current_row(), sec, sec->pnode[i]);
+                }
+            }
+        }
+    }
+    return result.release().ptr();
+}
+
+static PyObject* NPyColumn_segments_safe(NPyColumn* self) {
+    return nrn::convert_cxx_exceptions(NPyColumn_segments, self);
+}
+
+static PyObject* NPyColumn_getattro(NPyColumn* self, PyObject* pyname) {
+    if (PyUnicode_Check(pyname) &&
+        PyUnicode_CompareWithASCIIString(pyname, "__array_interface__") == 0) {
+        if (!column_valid(self)) {
+            PyErr_SetString(PyExc_RuntimeError, column_stale_msg);
+            return NULL;
+        }
+        // the ndarray keeps self alive, so its data must stay allocated
+        column_pin(self, true);
+        ++self->pins_;
+        int const one = 1;
+        const char* typestr = *reinterpret_cast<const char*>(&one) ? "<f8" : ">f8";
+        PyObject* shape = self->array_dim_ == 1
+                              ? Py_BuildValue("(n)", Py_ssize_t(self->size_))
+                              : Py_BuildValue("(nn)",
+                                              Py_ssize_t(self->size_),
+                                              Py_ssize_t(self->array_dim_));
+        return Py_BuildValue("{s:N,s:s,s:i,s:(N,O)}",
+                             "shape",
+                             shape,
+                             "typestr",
+                             typestr,
+                             "version",
+                             3,
+                             "data",
+                             PyLong_FromVoidPtr(self->data_),
+                             self->writable_ ? Py_False : Py_True);
+    }
+    return PyObject_GenericGetAttr((PyObject*) self, pyname);
+}
+
+static PyObject* NPyColumn_getattro_safe(NPyColumn* self, PyObject* pyname) {
+    return nrn::convert_cxx_exceptions(NPyColumn_getattro, self, pyname);
+}
+
 static PyObject* pysec_disconnect(NPySecObj* self) {
     CHECK_SEC_INVALID(self->sec_);
     nrn_disconnect(self->sec_);
@@ -2961,6 +3156,17 @@ static PyMethodDef NPyRangeVar_methods[] = {
      "Returns nrn.Mechanism of the  RangeVariable instance"},
     {NULL}};
 
+static PyMethodDef NPyColumn_methods[] = {
+    {"valid",
+     (PyCFunction) NPyColumn_valid_safe,
+     METH_NOARGS,
+     "False once the model data were reallocated or permuted"},
+    {"segments",
+     (PyCFunction) NPyColumn_segments_safe,
+     METH_NOARGS,
+     "List of the Segment of each row, None for rows without one"},
+    {NULL}};
+
 static PyMemberDef NPyMechObj_members[] = {{NULL}};
 
 // Returns a new reference.
@@ -2985,6 +3191,10 @@ static PyMethodDef nrnpy_methods[] = {
      nrnpy_set_psection_safe,
      METH_VARARGS,
      "Specify the nrn.Section.psection callback."},
+    {"column",
+     nrnpy_column_safe,
+     METH_VARARGS,
+     "Zero-copy view of the model data column of a range variable."},
     {NULL}};
 
 #include "nrnpy_nrn.h"
@@ -3051,6 +3261,11 @@ PyObject* nrnpy_nrn(void) {
         goto fail;
     Py_INCREF(opaque_pointer_type);
 
+    column_type = (PyTypeObject*) PyType_FromSpec(&nrnpy_ColumnType_spec);
+    if (PyType_Ready(column_type) < 0)
+        goto fail;
+    Py_INCREF(column_type);
+
     m = nb::steal(PyModule_Create(&nrnsectionmodule));  // like nrn but namespace will not include
                                                         // mechanims.
     PyModule_AddObject(m.ptr(), "Section", (PyObject*) psection_type);
@@ -3063,6 +3278,7 @@ PyObject* nrnpy_nrn(void) {
     PyModule_AddObject(m.ptr(), "Section", (PyObject*) psection_type);
     PyModule_AddObject(m.ptr(), "Segment", (PyObject*) psegment_type);
     PyModule_AddObject(m.ptr(), "OpaquePointer", (PyObject*) opaque_pointer_type);
+    PyModule_AddObject(m.ptr(), "Column", (PyObject*) column_type);
 
     pmech_generic_type = (PyTypeObject*) PyType_FromSpec(&nrnpy_MechanismType_spec);
     pmechfunc_generic_type = (PyTypeObject*) PyType_FromSpec(&nrnpy_MechFuncType_spec);
@@ -178,6 +178,21 @@ static PyType_Spec nrnpy_OpaquePointerType_spec = {
     nrnpy_OpaquePointerType_slots,
 };
 
+static PyType_Slot nrnpy_ColumnType_slots[] = {
+    {Py_tp_dealloc, (void*) NPyColumn_dealloc},
+    {Py_tp_getattro, (void*) NPyColumn_getattro_safe},
+    {Py_tp_methods, (void*) NPyColumn_methods},
+    {Py_tp_doc, (void*) "Zero-copy view of a model data column, see nrn.column"},
+    {0, 0},
+};
+static PyType_Spec nrnpy_ColumnType_spec = {
+    "nrn.Column",
+    sizeof(NPyColumn),
+    0,
+    Py_TPFLAGS_DEFAULT,
+    nrnpy_ColumnType_slots,
+};
+
 static struct PyModuleDef nrnmodule = {PyModuleDef_HEAD_INIT,
                                        "nrn",
                                        "NEURON interaction with Python",
@@ -1,7 +1,11 @@
 #include <../../nrnconf.h>
 
+#include <cstdint>
 #include <cstdio>
+#include <cstring>
+#include <functional>
 #include <optional>
+#include <string_view>
 
 #include <InterViews/resource.h>
 #include <nrnoc2iv.h>
@@ -521,14 +525,67 @@ static void setpickle() {
     loads.inc_ref();
 }
 
-// note that *size includes the null terminating character if it exists
-static std::vector<char> pickle(PyObject* p) {
-    auto r = nb::borrow<nb::bytes>(dumps(nb::borrow(p)));
+using pickle_parts_fn = std::function<void(const std::vector<std::string_view>&)>;
+using unpickle_part_fn = std::function<void(char*, std::size_t)>;
+
+// Pickles use protocol 5 so that large contiguous buffers, e.g. NumPy
+// arrays, are not copied into the pickle. If there are any, the result is a
+// 0 byte, the number of parts, the size of each part, then the parts: the
+// pickle itself followed by the out of band buffers. A plain pickle never
+// begins with a 0 byte. pk is given the pieces of the result, which point
+// into the pickle and the buffers themselves, so the caller can pack them
+// without first gathering them.
+static void pickle(PyObject* p, const pickle_parts_fn& pk) {
+    nb::list oob{};
+    auto r = nb::borrow<nb::bytes>(
+        dumps(nb::borrow(p), 5, nb::arg("buffer_callback") = oob.attr("append")));
     if (!r && PyErr_Occurred()) {
         PyErr_Print();
     }
     assert(r);
-    return std::vector<char>(r.c_str(), r.c_str() + r.size());
+    if (oob.size() == 0) {
+        pk(std::vector<std::string_view>{{r.c_str(), r.size()}});
+        return;
+    }
+    struct Views {
+        std::vector<Py_buffer> views;
+        std::size_t n{};  // acquired
+        ~Views() {
+            while (n > 0) {
+                PyBuffer_Release(&views[--n]);
+            }
+        }
+    } v{std::vector<Py_buffer>(oob.size())};
+    std::vector<nb::object> raw{};
+    std::vector<std::uint64_t> sizes{r.size()};
+    for (std::size_t i = 0; i < oob.size(); ++i) {
+        raw.push_back(oob[i].attr("raw")());  // contiguous bytes of the buffer
+        if (PyObject_GetBuffer(raw.back().ptr(), &v.views[i], PyBUF_SIMPLE) != 0) {
+            throw nb::python_error();
+        }
+        ++v.n;
+        sizes.push_back(v.views[i].len);
+    }
+    std::uint64_t n = sizes.size();
+    std::vector<char> head(1 + sizeof(n) * (n + 1));
+    head[0] = 0;
+    std::memcpy(head.data() + 1, &n, sizeof(n));
+    std::memcpy(head.data() + 1 + sizeof(n), sizes.data(), sizeof(n) * n);
+    std::vector<std::string_view> parts{{head.data(), head.size()}, {r.c_str(), r.size()}};
+    for (auto& view: v.views) {
+        parts.emplace_back(static_cast<const char*>(view.buf), view.len);
+    }
+    pk(parts);
+}
+
+static std::vector<char> pickle(PyObject* p) {
+    std::vector<char> s{};
+    pickle(p, [&s](const std::vector<std::string_view>& parts) {
+        for (auto part: parts) {
+            s.insert(s.end(), part.begin(), part.end());
+        }
+    });
+    return s;
 }
 
 static std::vector<char> po2pickle(Object* ho) {
@@ -540,8 +597,52 @@ static std::vector<char> po2pickle(Object* ho) {
     }
 }
 
+static bool po2pickle_parts(Object* ho, const pickle_parts_fn& pk) {
+    setpickle();
+    if (ho && ho->ctemplate->sym == nrnpy_pyobj_sym_) {
+        pickle(nrnpy_hoc2pyobject(ho), pk);
+        return true;
+    }
+    return false;
+}
+
+// The inverse of pickle() for a pickle of size len, whose consecutive parts
+// upk copies into the storage it is given. Each part goes straight into the
+// bytes or bytearray that loads uses, and the unpickled object uses the
+// bytearrays of the out of band buffers in place.
+static nb::object unpickle(std::size_t len, const unpickle_part_fn& upk) {
+    if (len == 0) {
+        return loads(nb::bytes("", 0));
+    }
+    char first;
+    upk(&first, 1);
+    if (first != 0) {
+        auto data = nb::steal<nb::bytes>(PyBytes_FromStringAndSize(nullptr, len));
+        char* q = PyBytes_AS_STRING(data.ptr());
+        q[0] = first;
+        upk(q + 1, len - 1);
+        return loads(data);
+    }
+    std::uint64_t n;
+    upk(reinterpret_cast<char*>(&n), sizeof(n));
+    std::vector<std::uint64_t> sizes(n);
+    upk(reinterpret_cast<char*>(sizes.data()), sizeof(n) * n);
+    auto data = nb::steal<nb::bytes>(PyBytes_FromStringAndSize(nullptr, sizes[0]));
+    upk(PyBytes_AS_STRING(data.ptr()), sizes[0]);
+    nb::list buffers{};
+    for (std::uint64_t i = 1; i < n; ++i) {
+        auto buf = nb::steal(PyByteArray_FromStringAndSize(nullptr, sizes[i]));
+        upk(PyByteArray_AS_STRING(buf.ptr()), sizes[i]);
+        buffers.append(buf);
+    }
+    return loads(data, nb::arg("buffers") = buffers);
+}
+
 static nb::object unpickle(const char* s, std::size_t len) {
-    return loads(nb::bytes(s, len));
+    return unpickle(len, [&s](char* dest, std::size_t n) {
+        std::memcpy(dest, s, n);
+        s += n;
+    });
 }
 
 static nb::object unpickle(const std::vector<char>& s) {
@@ -555,6 +656,13 @@ static Object* pickle2po(const std::vector<char>& s) {
     return ho;
 }
 
+static Object* upkpickle2po(std::size_t len, const unpickle_part_fn& upk) {
+    setpickle();
+    nb::object po = unpickle(len, upk);
+    Object* ho = nrnpy_pyobject_in_obj(po.ptr());
+    return ho;
+}
+
 /** Full python traceback error message returned as string.
  *  Caller should free the return value if not NULL
  **/
@@ -603,9 +711,9 @@ std::vector<char> call_picklef(const std::vector<char>& fname, int narg) {
     // hoc stack with types double, char*, hoc Vector, and PythonObject
     // callable return must be pickleable.
     setpickle();
-    nb::bytes ps(fname.data(), fname.size());
-
-    auto callable = nb::borrow<nb::callable>(loads(ps));
+    // a callable holding large arrays, e.g. functools.partial(f, ndarray),
+    // comes framed with out of band buffers
+    auto callable = nb::borrow<nb::callable>(unpickle(fname));
     assert(callable);
 
     nb::list args{};
@@ -931,8 +1039,10 @@ extern "C" NRN_EXPORT void nrnpython_reg_real(neuron::python::impl_ptrs* ptrs) {
     ptrs->mpi_alltoall_type = py_alltoall_type;
     ptrs->opaque_obj2pyobj = opaque_obj2pyobj;
     ptrs->pickle2po = pickle2po;
+    ptrs->upkpickle2po = upkpickle2po;
     ptrs->po2ho = nrnpy_po2ho;
     ptrs->po2pickle = po2pickle;
+    ptrs->po2pickle_parts = po2pickle_parts;
     ptrs->praxis_efun = praxis_efun;
     ptrs->pysame = pysame;
     ptrs->py2n_component = py2n_component;
@@ -11,6 +11,7 @@
 #include "nrnwrap_Python.h"
 #include "nrnpython.h"
 
+#include <cstdint>
 #include <thread>
 #include <vector>
 #include "ocmatrix.h"
@@ -1139,69 +1140,98 @@ extern "C" NRN_EXPORT void setup_solver(double* my_states,
     prev_structure_change_cnt = structure_change_cnt;
 }
 
-void TaskQueue_add_task(TaskQueue* q, void* (*task)(void*), void* args, void* result) {
-    auto* t = new TaskList{};
-    t->task = task;
-    t->args = args;
-    t->result = result;
-    t->next = nullptr;
-
-    // Add task to the queue
-    {
-        std::lock_guard<std::mutex> _{q->task_mutex};
-        if (!q->first) {
-            // empty queue
-            q->first = t;
-            q->last = t;
+namespace {
+// How often an idle thread polls the queue before it parks
+constexpr int spin_iterations = 4096;
+
+bool TaskQueue_try_push(TaskQueue* q, void* (*task)(void*), void* args, void* result) {
+    auto pos = q->enqueue_pos.load(std::memory_order_relaxed);
+    for (;;) {
+        auto& slot = q->slots[pos % TaskQueue::capacity];
+        auto const seq = slot.sequence.load(std::memory_order_acquire);
+        auto const dif = std::intptr_t(seq) - std::intptr_t(pos);
+        if (dif == 0) {
+            if (q->enqueue_pos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                slot.task = task;
+                slot.args = args;
+                slot.result = result;
+                slot.sequence.store(pos + 1, std::memory_order_release);
+                return true;
+            }
+        } else if (dif < 0) {
+            // full
+            return false;
         } else {
-            // queue not empty
-            q->last->next = t;
-            q->last = t;
+            pos = q->enqueue_pos.load(std::memory_order_relaxed);
         }
-        {
-            std::lock_guard<std::mutex> _{q->waiting_mutex};
-            ++q->length;
+    }
+}
+
+bool TaskQueue_try_run(TaskQueue* q) {
+    auto pos = q->dequeue_pos.load(std::memory_order_relaxed);
+    TaskList* slot{};
+    for (;;) {
+        slot = &q->slots[pos % TaskQueue::capacity];
+        auto const seq = slot->sequence.load(std::memory_order_acquire);
+        auto const dif = std::intptr_t(seq) - std::intptr_t(pos + 1);
+        if (dif == 0) {
+            if (q->dequeue_pos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                break;
+            }
+        } else if (dif < 0) {
+            // empty
+            return false;
+        } else {
+            pos = q->dequeue_pos.load(std::memory_order_relaxed);
         }
     }
+    auto* const task = slot->task;
+    auto* const args = slot->args;
+    // Release the slot before running the task, it can be reused straight away
+    slot->sequence.store(pos + TaskQueue::capacity, std::memory_order_release);
+    --q->queued;
+    task(args);
+    if (--q->length == 0 && q->sync_parked) {
+        // The main thread may be blocking in TaskQueue_sync.
+        std::lock_guard<std::mutex> _{q->waiting_mutex};
+        q->waiting_cond.notify_one();
+    }
+    return true;
+}
+}  // namespace
 
-    // signal a waiting thread that there is a new task to pick up
-    q->task_cond.notify_one();
+void TaskQueue_add_task(TaskQueue* q, void* (*task)(void*), void* args, void* result) {
+    ++q->length;
+    ++q->queued;
+    while (!TaskQueue_try_push(q, task, args, result)) {
+        // The ring is full, help empty it.
+        TaskQueue_try_run(q);
+    }
+    // Wake a parked worker, if any, to pick up the new task
+    if (q->sleepers > 0) {
+        std::lock_guard<std::mutex> _{q->task_mutex};
+        q->task_cond.notify_one();
+    }
 }
 
 void TaskQueue_exe_tasks(std::size_t thread_index, TaskQueue* q) {
     for (;;) {
-        // Wait for a task to be available in the queue, then execute it.
-        {
-            TaskList* job{};
-            {
-                std::unique_lock<std::mutex> lock{q->task_mutex};
-                // Wait until either for a new task to be received or for this
-                // thread to be told to exit.
-                q->task_cond.wait(lock,
-                                  [q, thread_index] { return q->first || q->exit[thread_index]; });
-                if (q->exit[thread_index]) {
-                    return;
-                }
-                job = q->first;
-                q->first = job->next;
+        // Run tasks as long as there are any, spinning for a while when the
+        // queue runs dry.
+        for (int spin = 0; spin < spin_iterations; ++spin) {
+            if (TaskQueue_try_run(q)) {
+                spin = 0;
+            } else if (thread_index >= q->num_workers) {
+                return;
             }
-            // Execute the task
-            job->result = job->task(job->args);
-            delete job;
-        }
-        // Decrement the list length, if it's now empty then broadcast that to
-        // the master thread, which may be waiting for the queue to be empty.
-        auto const new_length = [q] {
-            std::lock_guard<std::mutex> _{q->waiting_mutex};
-            return --(q->length);
-        }();
-        // The immediately-executed lambda means we release the mutex before
-        // calling notify_one()
-        if (new_length == 0) {
-            // Queue is empty. Notify the main thread, which may be blocking on
-            // this condition.
-            q->waiting_cond.notify_one();
         }
+        // Park until either a new task is pushed or this thread is told to exit.
+        std::unique_lock<std::mutex> lock{q->task_mutex};
+        ++q->sleepers;
+        q->task_cond.wait(lock, [q, thread_index] {
+            return q->queued > 0 || thread_index >= q->num_workers;
+        });
+        --q->sleepers;
     }
 }
 
@@ -1214,7 +1244,7 @@ extern "C" NRN_EXPORT void set_num_threads(const int n) {
     std::size_t const old_num = NUM_THREADS - 1;
     std::size_t const new_num = n - 1;
     assert(old_num == Threads.size());
-    assert(old_num == task_queue.exit.size());
+    assert(old_num == task_queue.num_workers);
     if (new_num < old_num) {
         // Kill some threads. First, wait until the queue is empty.
         TaskQueue_sync(&task_queue);
@@ -1222,42 +1252,41 @@ extern "C" NRN_EXPORT void set_num_threads(const int n) {
         // exit.
         {
             std::lock_guard<std::mutex> _{task_queue.task_mutex};
-            for (auto k = new_num; k < old_num; ++k) {
-                task_queue.exit[k] = true;
-            }
+            task_queue.num_workers = new_num;
         }
         task_queue.task_cond.notify_all();
         // Finally, join those threads and destroy the std::thread objects.
         for (auto k = new_num; k < old_num; ++k) {
             Threads[k].join();
         }
-        // And update the structures
-        {
-            std::lock_guard<std::mutex> _{task_queue.task_mutex};
-            Threads.resize(new_num);
-            task_queue.exit.resize(new_num);
-        }
+        Threads.resize(new_num);
     } else if (new_num > old_num) {
         // Create some threads
-        std::lock_guard<std::mutex> _{task_queue.task_mutex};
-        task_queue.exit.reserve(new_num);
+        task_queue.num_workers = new_num;
         Threads.reserve(new_num);
         for (auto k = old_num; k < new_num; ++k) {
             assert(k == Threads.size());
             Threads.emplace_back(TaskQueue_exe_tasks, k, &task_queue);
-            task_queue.exit.emplace_back(false);
         }
     }
     assert(new_num == Threads.size());
-    assert(new_num == task_queue.exit.size());
+    assert(new_num == task_queue.num_workers);
     set_num_threads_3D(n);
     NUM_THREADS = n;
 }
 
 void TaskQueue_sync(TaskQueue* q) {
-    // Wait till the queue is empty
-    std::unique_lock<std::mutex> lock{q->waiting_mutex};
-    q->waiting_cond.wait(lock, [q] { return q->length == 0; });
+    // Help with the remaining tasks, then wait for the ones still running.
+    for (int spin = 0; q->length > 0; ++spin) {
+        if (TaskQueue_try_run(q)) {
+            spin = 0;
+        } else if (spin >= spin_iterations) {
+            std::unique_lock<std::mutex> lock{q->waiting_mutex};
+            q->sync_parked = true;
+            q->waiting_cond.wait(lock, [q] { return q->length == 0; });
+            q->sync_parked = false;
+        }
+    }
 }
 
 extern "C" NRN_EXPORT int get_num_threads(void) {
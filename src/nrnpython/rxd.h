@@ -1,4 +1,6 @@
 #pragma once
+#include <array>
+#include <atomic>
 #include <condition_variable>
 #include <mutex>
 #include <thread>
@@ -83,16 +85,39 @@ struct TaskList {
     void* (*task)(void*);
     void* args;
     void* result;
-    struct TaskList* next;
+    // Position in the ring this slot holds a task for (+1) or is free for,
+    // see TaskQueue.
+    std::atomic<std::size_t> sequence;
 };
 
+/**
+ * Tasks for the rxd worker threads.
+ *
+ * A bounded ring of preallocated slots that the main thread pushes to and the
+ * workers pop from without taking a lock (D. Vyukov's bounded MPMC queue).
+ * Idle workers, and the main thread in TaskQueue_sync, spin for a while before
+ * they park on a condition variable, so a burst of small tasks per time step
+ * does not pay for a wake up per task.
+ */
 struct TaskQueue {
+    static constexpr std::size_t capacity = 256;  // power of two
+    std::array<TaskList, capacity> slots{};
+    alignas(64) std::atomic<std::size_t> enqueue_pos{};
+    alignas(64) std::atomic<std::size_t> dequeue_pos{};
+    // tasks pushed and not yet finished
+    alignas(64) std::atomic<int> length{};
+    // tasks pushed and not yet taken, and workers parked waiting for them
+    std::atomic<int> queued{}, sleepers{};
+    // workers with an index >= num_workers exit
+    std::atomic<std::size_t> num_workers{};
+    std::atomic<bool> sync_parked{};
     std::condition_variable task_cond, waiting_cond;
     std::mutex task_mutex, waiting_mutex;
-    std::vector<bool> exit;
-    int length{};
-    struct TaskList* first;
-    struct TaskList* last;
+    TaskQueue() {
+        for (std::size_t i = 0; i < capacity; ++i) {
+            slots[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
 };
 
 extern "C" void set_num_threads(const int);
@@ -103,9 +128,43 @@ extern "C" int get_num_threads(void);
 void ecs_set_adi_tort(ECS_Grid_node*);
 void ecs_set_adi_vol(ECS_Grid_node*);
 void ecs_set_adi_homogeneous(ECS_Grid_node*);
+int ecs_multigrid_solve(ECS_Grid_node*, const double, const double*, double*);
+void ecs_multigrid_free(ECSMultigrid*);
+int ecs_decomposition_create(ECS_Grid_node*);
+void ecs_decomposition_free(ECSDecomposition*);
+void ecs_decomposition_owned(ECS_Grid_node*, unsigned int*, unsigned int*);
+void ecs_decomposition_set_currents(ECS_Grid_node*);
+void ecs_decomposition_set_concentrations(ECS_Grid_node*);
+void ecs_decomposition_currents(ECS_Grid_node*, const double*, double*, const double);
+void ecs_decomposition_readout(ECS_Grid_node*, double*);
+void ecs_decomposition_dg_adi(ECS_Grid_node*);
+void ecs_decomposition_rhs(ECS_Grid_node*, double*);
 
 void dg_transfer_data(AdiLineData* const, double* const, int const, int const, int const);
 void ecs_run_threaded_dg_adi(const int, const int, ECS_Grid_node*, ECSAdiDirection*, const int);
+void ecs_run_threaded_dg_adi_lines(const int, const int, const int, ECS_Grid_node*, ECSAdiDirection*);
+int ecs_dg_adi_x_range(ECS_Grid_node*,
+                       const double,
+                       const int,
+                       const int,
+                       const int,
+                       const int,
+                       double const* const,
+                       double* const);
+void ecs_adi_factors(ECS_Grid_node*,
+                     ECSAdiDirection*,
+                     const double,
+                     const int,
+                     double* const,
+                     double* const,
+                     double* const);
+void ecs_solve_adi_lines(const int,
+                         const int,
+                         double* const* const,
+                         double const* const,
+                         double const* const,
+                         double const* const,
+                         double* const);
 ReactGridData* create_threaded_reactions(const int);
 void* do_reactions(void*);
 
@@ -0,0 +1,454 @@
+#include <../../nrnconf.h>
+#include <stdio.h>
+#include <assert.h>
+#include <string.h>
+#include <algorithm>
+#include <vector>
+#include "grids.h"
+#include "rxd.h"
+#include "nrnwrap_Python.h"
+
+/*****************************************************************************
+ *
+ * Slab decomposition of extracellular grids over MPI ranks
+ *
+ * Without it every rank advances the whole of every extracellular grid and
+ * the membrane currents of all ranks are gathered on every rank. A decomposed
+ * grid is split into slabs of whole x planes; rank r advances the planes
+ * r * size_x / nhost <= x < (r + 1) * size_x / nhost. The states array keeps
+ * its full size so the Python side is unchanged, but outside its slab a rank
+ * only keeps up to date the planes either side and the voxels that its own
+ * segments read.
+ *
+ * Each fixed step
+ *  - reactions only run on the voxels of the slab (Reaction::owned_start),
+ *  - the membrane currents are sent to the ranks that own their voxels,
+ *  - the planes either side of the slab are exchanged with the neighbouring
+ *    ranks before the x sweep of DG-ADI. The x lines cross the slabs, so
+ *    their right hand sides are transposed for each rank to hold whole lines
+ *    for a range of y, solved there and transposed back. The y and z sweeps
+ *    stay within the slab,
+ *  - the owners send the voxels read by the segments of other ranks.
+ * The variable step right hand side exchanges the same planes and leaves the
+ * voxels of other ranks constant.
+ *
+ *****************************************************************************/
+
+#if NRNMPI
+
+#define ECS_HALO_TAG 0xec5
+
+struct ECSDecomposition {
+    int nprocs, rank;
+    /* the planes of each rank, and the y of the x lines each rank solves */
+    std::vector<int> x_start, y_start;
+    /* the x sweep transposes, blocks of [y][z][x] in rank order */
+    std::vector<int> xt_send_cnt, xt_send_dsp, xt_recv_cnt, xt_recv_dsp;
+    std::vector<double> xt_send, xt_recv;
+    /* local membrane currents, in the order they are sent to the owners of
+     * their voxels, and the voxels of the currents received */
+    std::vector<int> cur_send_cnt, cur_send_dsp, cur_recv_cnt, cur_recv_dsp;
+    std::vector<int> cur_order;
+    std::vector<int64_t> cur_recv_voxel;
+    std::vector<double> cur_send, cur_recv;
+    /* voxels of this slab read by other ranks, and voxels read from them */
+    std::vector<int> conc_send_cnt, conc_send_dsp, conc_recv_cnt, conc_recv_dsp;
+    std::vector<int64_t> conc_send_voxel, conc_recv_voxel;
+    std::vector<double> conc_send, conc_recv;
+
+    int x0() const {
+        return x_start[rank];
+    }
+    int x1() const {
+        return x_start[rank + 1];
+    }
+    int owner(const int x) const {
+        return int(std::upper_bound(x_start.begin(), x_start.end(), x) - x_start.begin()) - 1;
+    }
+};
+
+static int decomposition_displs(const std::vector<int>& cnt, std::vector<int>& dsp) {
+    int n = 0;
+    dsp.resize(cnt.size());
+    for (size_t i = 0; i < cnt.size(); i++) {
+        dsp[i] = n;
+        n += cnt[i];
+    }
+    return n;
+}
+
+/* ecs_decomposition_create splits g between the ranks.
+ * Returns 0, also when there is a single rank and nothing to split, or -1 if
+ * the grid cannot be decomposed: it needs a homogeneous grid with the ADI
+ * solver and at least one x plane per rank.
+ */
+int ecs_decomposition_create(ECS_Grid_node* g) {
+    if (!nrnmpi_use || nrnmpi_numprocs < 2) {
+        return 0;
+    }
+    const int nprocs = nrnmpi_numprocs;
+    if (g->VARIABLE_ECS_VOLUME != FALSE || g->ecs_solver != ECS_SOLVER_ADI ||
+        g->size_x < nprocs) {
+        return -1;
+    }
+    ECSDecomposition* d = new ECSDecomposition;
+    d->nprocs = nprocs;
+    d->rank = nrnmpi_myid;
+    d->x_start.resize(nprocs + 1);
+    d->y_start.resize(nprocs + 1);
+    for (int r = 0; r <= nprocs; r++) {
+        d->x_start[r] = int((long) r * g->size_x / nprocs);
+        d->y_start[r] = int((long) r * g->size_y / nprocs);
+    }
+    const int nxl = d->x1() - d->x0();
+    const int nyl = d->y_start[d->rank + 1] - d->y_start[d->rank];
+    d->xt_send_cnt.resize(nprocs);
+    d->xt_recv_cnt.resize(nprocs);
+    for (int r = 0; r < nprocs; r++) {
+        d->xt_send_cnt[r] = (d->y_start[r + 1] - d->y_start[r]) * g->size_z * nxl;
+        d->xt_recv_cnt[r] = nyl * g->size_z * (d->x_start[r + 1] - d->x_start[r]);
+    }
+    d->xt_send.resize(decomposition_displs(d->xt_send_cnt, d->xt_send_dsp));
+    d->xt_recv.resize(decomposition_displs(d->xt_recv_cnt, d->xt_recv_dsp));
+    /* nothing is exchanged until the segments are known */
+    d->cur_send_cnt.assign(nprocs, 0);
+    d->cur_recv_cnt.assign(nprocs, 0);
+    decomposition_displs(d->cur_send_cnt, d->cur_send_dsp);
+    decomposition_displs(d->cur_recv_cnt, d->cur_recv_dsp);
+    d->conc_send_cnt.assign(nprocs, 0);
+    d->conc_recv_cnt.assign(nprocs, 0);
+    decomposition_displs(d->conc_send_cnt, d->conc_send_dsp);
+    decomposition_displs(d->conc_recv_cnt, d->conc_recv_dsp);
+
+    ecs_decomposition_free(g->decomposition);
+    g->decomposition = d;
+    return 0;
+}
+
+void ecs_decomposition_free(ECSDecomposition* d) {
+    delete d;
+}
+
+/* the voxels start <= i < stop of the slab of this rank */
+void ecs_decomposition_owned(ECS_Grid_node* g, unsigned int* start, unsigned int* stop) {
+    const unsigned int plane = g->size_y * g->size_z;
+    *start = g->decomposition->x0() * plane;
+    *stop = g->decomposition->x1() * plane;
+}
+
+/* ecs_decomposition_set_currents sends the voxels of the local membrane
+ * currents (Grid_node::current_list) to the ranks that own them.
+ */
+void ecs_decomposition_set_currents(ECS_Grid_node* g) {
+    ECSDecomposition* d = g->decomposition;
+    const long plane = (long) g->size_y * g->size_z;
+    const int n = g->num_currents;
+    std::vector<int> owner(n);
+    std::vector<int64_t> voxels(n);
+    std::fill(d->cur_send_cnt.begin(), d->cur_send_cnt.end(), 0);
+    for (int i = 0; i < n; i++) {
+        owner[i] = d->owner(g->current_list[i].destination / plane);
+        d->cur_send_cnt[owner[i]]++;
+    }
+    decomposition_displs(d->cur_send_cnt, d->cur_send_dsp);
+    std::vector<int> next(d->cur_send_dsp);
+    d->cur_order.resize(n);
+    for (int i = 0; i < n; i++) {
+        int k = next[owner[i]]++;
+        d->cur_order[k] = i;
+        voxels[k] = g->current_list[i].destination;
+    }
+    nrnmpi_int_alltoall(d->cur_send_cnt.data(), d->cur_recv_cnt.data(), 1);
+    int nrecv = decomposition_displs(d->cur_recv_cnt, d->cur_recv_dsp);
+    d->cur_recv_voxel.resize(nrecv);
+    nrnmpi_long_alltoallv(voxels.data(),
+                          d->cur_send_cnt.data(),
+                          d->cur_send_dsp.data(),
+                          d->cur_recv_voxel.data(),
+                          d->cur_recv_cnt.data(),
+                          d->cur_recv_dsp.data());
+    d->cur_send.resize(n);
+    d->cur_recv.resize(nrecv);
+}
+
+/* ecs_decomposition_currents adds dt times the local currents val (in the
+ * order of current_list) and those sent by other ranks to their voxels */
+void ecs_decomposition_currents(ECS_Grid_node* g,
+                                const double* val,
+                                double* output,
+                                const double dt) {
+    ECSDecomposition* d = g->decomposition;
+    for (size_t k = 0; k < d->cur_order.size(); k++) {
+        d->cur_send[k] = val[d->cur_order[k]];
+    }
+    nrnmpi_dbl_alltoallv(d->cur_send.data(),
+                         d->cur_send_cnt.data(),
+                         d->cur_send_dsp.data(),
+                         d->cur_recv.data(),
+                         d->cur_recv_cnt.data(),
+                         d->cur_recv_dsp.data());
+    for (size_t k = 0; k < d->cur_recv.size(); k++) {
+        output[d->cur_recv_voxel[k]] += dt * d->cur_recv[k];
+    }
+}
+
+/* ecs_decomposition_set_concentrations asks the owners for the voxels that
+ * the local segments read (Grid_node::concentration_list) outside the slab.
+ */
+void ecs_decomposition_set_concentrations(ECS_Grid_node* g) {
+    ECSDecomposition* d = g->decomposition;
+    const long plane = (long) g->size_y * g->size_z;
+    const long start = d->x0() * plane, stop = d->x1() * plane;
+    std::vector<int64_t>& voxels = d->conc_recv_voxel;
+    voxels.clear();
+    for (ssize_t i = 0; i < g->num_concentrations; i++) {
+        long v = g->concentration_list[i].source;
+        if (v < start || v >= stop) {
+            voxels.push_back(v);
+        }
+    }
+    /* the owners are in the same order as the voxels */
+    std::sort(voxels.begin(), voxels.end());
+    voxels.erase(std::unique(voxels.begin(), voxels.end()), voxels.end());
+    std::fill(d->conc_recv_cnt.begin(), d->conc_recv_cnt.end(), 0);
+    for (int64_t v: voxels) {
+        d->conc_recv_cnt[d->owner(v / plane)]++;
+    }
+    decomposition_displs(d->conc_recv_cnt, d->conc_recv_dsp);
+    nrnmpi_int_alltoall(d->conc_recv_cnt.data(), d->conc_send_cnt.data(), 1);
+    int nsend = decomposition_displs(d->conc_send_cnt, d->conc_send_dsp);
+    d->conc_send_voxel.resize(nsend);
+    nrnmpi_long_alltoallv(voxels.data(),
+                          d->conc_recv_cnt.data(),
+                          d->conc_recv_dsp.data(),
+                          d->conc_send_voxel.data(),
+                          d->conc_send_cnt.data(),
+                          d->conc_send_dsp.data());
+    d->conc_send.resize(nsend);
+    d->conc_recv.resize(voxels.size());
+}
+
+/* ecs_decomposition_readout refreshes the voxels of states that the local
+ * segments read from other ranks */
+void ecs_decomposition_readout(ECS_Grid_node* g, double* states) {
+    ECSDecomposition* d = g->decomposition;
+    for (size_t k = 0; k < d->conc_send_voxel.size(); k++) {
+        d->conc_send[k] = states[d->conc_send_voxel[k]];
+    }
+    nrnmpi_dbl_alltoallv(d->conc_send.data(),
+                         d->conc_send_cnt.data(),
+                         d->conc_send_dsp.data(),
+                         d->conc_recv.data(),
+                         d->conc_recv_cnt.data(),
+                         d->conc_recv_dsp.data());
+    for (size_t k = 0; k < d->conc_recv_voxel.size(); k++) {
+        states[d->conc_recv_voxel[k]] = d->conc_recv[k];
+    }
+}
+
+/* exchange the first and last planes of the slab with the neighbouring ranks */
+static void ecs_decomposition_halo(ECS_Grid_node* g, double* states) {
+    ECSDecomposition* d = g->decomposition;
+    const int plane = g->size_y * g->size_z;
+    const int x0 = d->x0(), x1 = d->x1();
+    void* request[2];
+    int nrequest = 0;
+    if (x0 > 0) {
+        nrnmpi_postrecv_doubles(
+            states + (long) (x0 - 1) * plane, plane, d->rank - 1, ECS_HALO_TAG, &request[nrequest++]);
+    }
+    if (x1 < g->size_x) {
+        nrnmpi_postrecv_doubles(
+            states + (long) x1 * plane, plane, d->rank + 1, ECS_HALO_TAG, &request[nrequest++]);
+    }
+    if (x0 > 0) {
+        nrnmpi_send_doubles(states + (long) x0 * plane, plane, d->rank - 1, ECS_HALO_TAG);
+    }
+    if (x1 < g->size_x) {
+        nrnmpi_send_doubles(states + (long) (x1 - 1) * plane, plane, d->rank + 1, ECS_HALO_TAG);
+    }
+    for (int i = 0; i < nrequest; i++) {
+        nrnmpi_wait(&request[i]);
+    }
+}
+
+/* ecs_decomposition_dg_adi is ECS_Grid_node::dg_adi for a decomposed
+ * homogeneous grid, it advances the states of the slab */
+void ecs_decomposition_dg_adi(ECS_Grid_node* g) {
+    ECSDecomposition* d = g->decomposition;
+    const double dt = *dt_ptr;
+    const int nx = g->size_x, ny = g->size_y, nz = g->size_z;
+    const int x0 = d->x0(), x1 = d->x1(), nxl = x1 - x0;
+    const int y0 = d->y_start[d->rank], y1 = d->y_start[d->rank + 1];
+    const size_t plane = (size_t) ny * nz;
+    int y, z, k, r;
+
+    ecs_decomposition_halo(g, g->states);
+
+    /* the right hand sides of the x lines through the slab, in the order of
+     * the ranks that solve them */
+    std::vector<double> line(nx);
+    double* out = d->xt_send.data();
+    for (y = 0; y < ny; y++) {
+        for (z = 0; z < nz; z++, out += nxl) {
+            ecs_dg_adi_x_range(g, dt, y, z, x0, x1, g->states, line.data());
+            memcpy(out, &line[x0], sizeof(double) * nxl);
+        }
+    }
+    nrnmpi_dbl_alltoallv(d->xt_send.data(),
+                         d->xt_send_cnt.data(),
+                         d->xt_send_dsp.data(),
+                         d->xt_recv.data(),
+                         d->xt_recv_cnt.data(),
+                         d->xt_recv_dsp.data());
+
+    /* solve the whole lines for y0 <= y < y1 in batches, lines on a
+     * Dirichlet boundary already hold their values */
+    if (nx > 1) {
+        std::vector<double> factors(3 * nx);
+        std::vector<double> lines_data(ECS_ADI_LANES * nx), scratch(ECS_ADI_LANES * nx);
+        double* lines[ECS_ADI_LANES];
+        int ids[ECS_ADI_LANES];
+        double* c = factors.data();
+        double* dd = c + nx;
+        double* a = dd + nx;
+        ecs_adi_factors(g, g->ecs_adi_dir_x, dt, nx, c, dd, a);
+        for (k = 0; k < ECS_ADI_LANES; k++) {
+            lines[k] = &lines_data[k * nx];
+        }
+        const int nlines = (y1 - y0) * nz;
+        for (int l = 0; l < nlines;) {
+            int n = 0;
+            for (; l < nlines && n < ECS_ADI_LANES; l++) {
+                y = y0 + l / nz;
+                z = l % nz;
+                if (g->bc->type == DIRICHLET &&
+                    (y == 0 || z == 0 || y == ny - 1 || z == nz - 1)) {
+                    continue;
+                }
+                for (r = 0; r < d->nprocs; r++) {
+                    const int nxr = d->x_start[r + 1] - d->x_start[r];
+                    memcpy(&lines[n][d->x_start[r]],
+                           &d->xt_recv[d->xt_recv_dsp[r] + (size_t) l * nxr],
+                           sizeof(double) * nxr);
+                }
+                ids[n++] = l;
+            }
+            if (n == 0) {
+                continue;
+            }
+            ecs_solve_adi_lines(nx, n, lines, c, dd, a, scratch.data());
+            for (k = 0; k < n; k++) {
+                for (r = 0; r < d->nprocs; r++) {
+                    const int nxr = d->x_start[r + 1] - d->x_start[r];
+                    memcpy(&d->xt_recv[d->xt_recv_dsp[r] + (size_t) ids[k] * nxr],
+                           &lines[k][d->x_start[r]],
+                           sizeof(double) * nxr);
+                }
+            }
+        }
+    }
+    nrnmpi_dbl_alltoallv(d->xt_recv.data(),
+                         d->xt_recv_cnt.data(),
+                         d->xt_recv_dsp.data(),
+                         d->xt_send.data(),
+                         d->xt_send_cnt.data(),
+                         d->xt_send_dsp.data());
+    const double* in = d->xt_send.data();
+    for (y = 0; y < ny; y++) {
+        for (z = 0; z < nz; z++, in += nxl) {
+            memcpy(&g->states_x[((size_t) y * nz + z) * nx + x0], in, sizeof(double) * nxl);
+        }
+    }
+
+    /* the y and z lines of the slab */
+    ecs_run_threaded_dg_adi_lines(x0 * nz, x1 * nz, nz, g, g->ecs_adi_dir_y);
+    ecs_run_threaded_dg_adi_lines(x0 * ny, x1 * ny, ny, g, g->ecs_adi_dir_z);
+    memcpy(g->states + x0 * plane,
+           g->ecs_adi_dir_z->states_out + x0 * plane,
+           sizeof(double) * nxl * plane);
+}
+
+/* ecs_decomposition_rhs adds the diffusion of the slab to ydot, as
+ * _rhs_variable_step_helper does for the whole grid, and zeroes ydot for the
+ * voxels of other ranks */
+void ecs_decomposition_rhs(ECS_Grid_node* g, double* ydot) {
+    ECSDecomposition* d = g->decomposition;
+    const int nx = g->size_x, ny = g->size_y, nz = g->size_z;
+    const int x0 = d->x0(), x1 = d->x1();
+    const size_t plane = (size_t) ny * nz;
+    const double rate_x = g->dc_x / (g->dx * g->dx);
+    const double rate_y = g->dc_y / (g->dy * g->dy);
+    const double rate_z = g->dc_z / (g->dz * g->dz);
+    double const* const s = g->states;
+
+    ecs_decomposition_halo(g, g->states);
+    for (int i = x0; i < x1; i++) {
+        for (int j = 0; j < ny; j++) {
+            for (int k = 0; k < nz; k++) {
+                const size_t index = i * plane + j * nz + k;
+                if (g->bc->type == NEUMANN) {
+                    /*zero flux boundary conditions*/
+                    if (nx > 1) {
+                        const int prev = i == 0 ? i + 1 : i - 1;
+                        const int next = i == nx - 1 ? i - 1 : i + 1;
+                        ydot[index] += rate_x *
+                                       (s[index + (prev - i) * plane] - 2.0 * s[index] +
+                                        s[index + (next - i) * plane]) /
+                                       ((i == 0 || i == nx - 1) ? 2. : 1.);
+                    }
+                    if (ny > 1) {
+                        const int prev = j == 0 ? j + 1 : j - 1;
+                        const int next = j == ny - 1 ? j - 1 : j + 1;
+                        ydot[index] += rate_y *
+                                       (s[index + (prev - j) * nz] - 2.0 * s[index] +
+                                        s[index + (next - j) * nz]) /
+                                       ((j == 0 || j == ny - 1) ? 2. : 1.);
+                    }
+                    if (nz > 1) {
+                        const int prev = k == 0 ? k + 1 : k - 1;
+                        const int next = k == nz - 1 ? k - 1 : k + 1;
+                        ydot[index] += rate_z *
+                                       (s[index + prev - k] - 2.0 * s[index] + s[index + next - k]) /
+                                       ((k == 0 || k == nz - 1) ? 2. : 1.);
+                    }
+                } else if (i == 0 || i == nx - 1 || j == 0 || j == ny - 1 || k == 0 ||
+                           k == nz - 1) {
+                    // set to zero to prevent currents altering concentrations at the boundary
+                    ydot[index] = 0;
+                } else {
+                    ydot[index] += rate_x *
+                                   (s[index - plane] - 2.0 * s[index] + s[index + plane]);
+                    ydot[index] += rate_y * (s[index - nz] - 2.0 * s[index] + s[index + nz]);
+                    ydot[index] += rate_z * (s[index - 1] - 2.0 * s[index] + s[index + 1]);
+                }
+            }
+        }
+    }
+    memset(ydot, 0, sizeof(double) * x0 * plane);
+    memset(ydot + x1 * plane, 0, sizeof(double) * (nx - x1) * plane);
+}
+
+#else
+
+int ecs_decomposition_create(ECS_Grid_node*) {
+    return 0;
+}
+
+void ecs_decomposition_free(ECSDecomposition*) {}
+
+void ecs_decomposition_owned(ECS_Grid_node*, unsigned int*, unsigned int*) {}
+
+void ecs_decomposition_set_currents(ECS_Grid_node*) {}
+
+void ecs_decomposition_set_concentrations(ECS_Grid_node*) {}
+
+void ecs_decomposition_currents(ECS_Grid_node*, const double*, double*, const double) {}
+
+void ecs_decomposition_readout(ECS_Grid_node*, double*) {}
+
+void ecs_decomposition_dg_adi(ECS_Grid_node*) {}
+
+void ecs_decomposition_rhs(ECS_Grid_node*, double*) {}
+
+#endif
@@ -5,6 +5,8 @@
 #include "grids.h"
 #include "rxd.h"
 #include "nrnwrap_Python.h"
+#include <algorithm>
+#include <climits>
 #include <cmath>
 #include <ocmatrix.h>
 #include <cfloat>
@@ -101,6 +103,9 @@ Reaction* ecs_create_reaction(int list_idx,
     r = (Reaction*) malloc(sizeof(Reaction));
     assert(r);
     r->reaction = f;
+    r->reaction_batch = NULL;
+    r->owned_start = 0;
+    r->owned_stop = UINT_MAX;
     /*place reaction on the top of the stack of reactions*/
     r->next = ecs_reactions;
     ecs_reactions = r;
@@ -136,6 +141,10 @@ Reaction* ecs_create_reaction(int list_idx,
                 r->subregion = subregion;
                 r->mc3d_indices_offsets = NULL;
             }
+            ECS_Grid_node* g = dynamic_cast<ECS_Grid_node*>(grid);
+            if (mc3d_region_size == 0 && g && g->decomposition) {
+                ecs_decomposition_owned(g, &r->owned_start, &r->owned_stop);
+            }
         }
     }
 
@@ -187,13 +196,17 @@ extern "C" NRN_EXPORT void ics_register_reaction(int list_idx,
  * 	(currently this is always 0)
  * grid_id - the grid id within the linked list - this corresponds to species
  * ECSReactionRate - the reaction function
+ * ECSReactionBatch - the same reaction for a batch of voxels
  */
 extern "C" NRN_EXPORT void ecs_register_reaction(int list_idx,
                                                  int num_species,
                                                  int num_params,
                                                  int* species_id,
-                                                 ECSReactionRate f) {
-    ecs_create_reaction(list_idx, num_species, num_params, species_id, f, NULL, NULL, 0, NULL);
+                                                 ECSReactionRate f,
+                                                 ECSReactionBatch fbatch) {
+    Reaction* r =
+        ecs_create_reaction(list_idx, num_species, num_params, species_id, f, NULL, NULL, 0, NULL);
+    r->reaction_batch = fbatch;
     ecs_refresh_reactions(NUM_THREADS);
 }
 
@@ -229,7 +242,8 @@ ReactGridData* create_threaded_reactions(const int n) {
     Reaction* react;
 
     for (react = ecs_reactions; react != NULL; react = react->next)
-        react_count += react->region_size;
+        react_count += MIN(react->region_size, react->owned_stop) -
+                       MIN(react->region_size, react->owned_start);
 
     if (react_count == 0)
         return NULL;
@@ -245,7 +259,8 @@ ReactGridData* create_threaded_reactions(const int n) {
 
     for (k = 0, load = 0, react = ecs_reactions; react != NULL; react = react->next) {
         for (i = 0; i < react->region_size; i++) {
-            if (!react->subregion || react->subregion[i])
+            if ((!react->subregion || react->subregion[i]) && i >= react->owned_start &&
+                i < react->owned_stop)
                 load++;
             if (load >= tasks_per_thread + (extra > k)) {
                 tasks[k].offset = (ReactSet*) malloc(sizeof(ReactSet));
@@ -269,6 +284,127 @@ ReactGridData* create_threaded_reactions(const int n) {
     return tasks;
 }
 
+/* ecs_solve_reaction_jacobian solves jacobian x = b by Gaussian elimination,
+ * for reactions between n > 1 species; jacobian and b are overwritten.
+ */
+static void ecs_solve_reaction_jacobian(OcFullMatrix& jacobian,
+                                        std::vector<double>& b,
+                                        std::vector<double>& x,
+                                        const unsigned int n) {
+    unsigned int j, k, m;
+    double temp, ge_value, val_to_set;
+    // find entry in leftmost column with largest absolute value
+    // Pivot
+    for (j = 0; j < n; j++) {
+        for (k = j + 1; k < n; k++) {
+            if (abs(jacobian(j, j)) < abs(jacobian(k, j))) {
+                for (m = 0; m < n; m++) {
+                    temp = jacobian(j, m);
+                    jacobian(j, m) = jacobian(k, m);
+                    jacobian(k, m) = temp;
+                }
+            }
+        }
+    }
+
+    for (j = 0; j < n - 1; j++) {
+        for (k = j + 1; k < n; k++) {
+            ge_value = jacobian(k, j) / jacobian(j, j);
+            for (m = 0; m < n; m++) {
+                val_to_set = jacobian(k, m) - ge_value * jacobian(j, m);
+                jacobian(k, m) = val_to_set;
+            }
+            b[k] = b[k] - ge_value * b[j];
+        }
+    }
+
+    for (j = n - 1; j + 1 > 0; j--) {
+        x[j] = b[j];
+        for (k = j + 1; k < n; k++) {
+            if (k != j) {
+                x[j] = x[j] - jacobian(j, k) * x[k];
+            }
+        }
+        x[j] = x[j] / jacobian(j, j);
+    }
+}
+
+/* ecs_do_reaction_batch advances the voxels start_idx to stop_idx of a
+ * reaction with a batched kernel. The voxels are gathered ECS_REACTION_BATCH
+ * at a time, the kernel evaluates the rates and each finite difference column
+ * of the Jacobian for all of them at once, and then each voxel takes the same
+ * implicit step as in ecs_do_reactions.
+ */
+static void ecs_do_reaction_batch(Reaction* react,
+                                  const unsigned int start_idx,
+                                  const unsigned int stop_idx,
+                                  const double dt) {
+    const unsigned int ns = react->num_species_involved;
+    const unsigned int np = react->num_params_involved;
+    const double dx = FLT_EPSILON;
+    unsigned int i, j, k, c, n;
+    unsigned int voxels[ECS_REACTION_BATCH];
+    std::vector<double> states(ns * ECS_REACTION_BATCH);
+    std::vector<double> states_dx(ns * ECS_REACTION_BATCH);
+    std::vector<double> params(std::max(np, 1u) * ECS_REACTION_BATCH);
+    std::vector<double> results(ns * ECS_REACTION_BATCH);
+    /* one block of rates per perturbed species */
+    std::vector<double> results_dx(ns * ns * ECS_REACTION_BATCH);
+    OcFullMatrix jacobian(ns, ns);
+    std::vector<double> b(ns);
+    std::vector<double> x(ns);
+
+    for (i = start_idx; i <= stop_idx;) {
+        for (n = 0; i <= stop_idx && n < ECS_REACTION_BATCH; i++) {
+            if (!react->subregion || react->subregion[i]) {
+                voxels[n++] = i;
+            }
+        }
+        if (n == 0) {
+            break;
+        }
+        for (j = 0; j < ns; j++) {
+            for (c = 0; c < n; c++) {
+                states[j * n + c] = react->species_states[j][voxels[c]];
+                states_dx[j * n + c] = states[j * n + c];
+            }
+        }
+        for (k = 0; k < np; k++) {
+            for (c = 0; c < n; c++) {
+                params[k * n + c] = react->species_states[ns + k][voxels[c]];
+            }
+        }
+        react->reaction_batch(n, states.data(), params.data(), results.data());
+        for (j = 0; j < ns; j++) {
+            for (c = 0; c < n; c++) {
+                states_dx[j * n + c] += dx;
+            }
+            react->reaction_batch(n, states_dx.data(), params.data(), &results_dx[j * ns * n]);
+            for (c = 0; c < n; c++) {
+                states_dx[j * n + c] -= dx;
+            }
+        }
+
+        for (c = 0; c < n; c++) {
+            for (j = 0; j < ns; j++) {
+                b[j] = dt * results[j * n + c];
+                for (k = 0; k < ns; k++) {
+                    double pd = (results_dx[(j * ns + k) * n + c] - results[k * n + c]) / dx;
+                    jacobian(k, j) = (j == k) - dt * pd;
+                }
+            }
+            if (ns == 1) {
+                react->species_states[0][voxels[c]] += b[0] / jacobian(0, 0);
+            } else {
+                ecs_solve_reaction_jacobian(jacobian, b, x, ns);
+                for (j = 0; j < ns; j++) {
+                    react->species_states[j][voxels[c]] += x[j];
+                }
+            }
+        }
+    }
+}
+
 /*ecs_do_reactions takes ReactGridData which defines the set of reactions to be
  * performed. It calculate the reaction based on grid->old_states and updates
  * grid->states
@@ -276,8 +412,7 @@ ReactGridData* create_threaded_reactions(const int n) {
 void* ecs_do_reactions(void* dataptr) {
     ReactGridData task = *(ReactGridData*) dataptr;
     unsigned char started = FALSE, stop = FALSE;
-    unsigned int i, j, k, n, start_idx, stop_idx, offset_idx;
-    double temp, ge_value, val_to_set;
+    unsigned int i, j, k, start_idx, stop_idx, offset_idx;
     double dt = *dt_ptr;
     Reaction* react;
 
@@ -363,40 +498,8 @@ void* ecs_do_reactions(void* dataptr) {
                         if (react->num_species_involved == 1) {
                             react->species_states[0][i] += b[0] / jacobian(0, 0);
                         } else {
-                            // find entry in leftmost column with largest absolute value
-                            // Pivot
-                            for (j = 0; j < react->num_species_involved; j++) {
-                                for (k = j + 1; k < react->num_species_involved; k++) {
-                                    if (abs(jacobian(j, j)) < abs(jacobian(k, j))) {
-                                        for (n = 0; n < react->num_species_involved; n++) {
-                                            temp = jacobian(j, n);
-                                            jacobian(j, n) = jacobian(k, n);
-                                            jacobian(k, n) = temp;
-                                        }
-                                    }
-                                }
-                            }
-
-                            for (j = 0; j < react->num_species_involved - 1; j++) {
-                                for (k = j + 1; k < react->num_species_involved; k++) {
-                                    ge_value = jacobian(k, j) / jacobian(j, j);
-                                    for (n = 0; n < react->num_species_involved; n++) {
-                                        val_to_set = jacobian(k, n) - ge_value * jacobian(j, n);
-                                        jacobian(k, n) = val_to_set;
-                                    }
-                                    b[k] = b[k] - ge_value * b[j];
-                                }
-                            }
-
-                            for (j = react->num_species_involved - 1; j + 1 > 0; j--) {
-                                x[j] = b[j];
-                                for (k = j + 1; k < react->num_species_involved; k++) {
-                                    if (k != j) {
-                                        x[j] = x[j] - jacobian(j, k) * x[k];
-                                    }
-                                }
-                                x[j] = x[j] / jacobian(j, j);
-                            }
+                            ecs_solve_reaction_jacobian(
+                                jacobian, b, x, react->num_species_involved);
                             for (j = 0; j < react->num_species_involved; j++) {
                                 // I think this should be something like
                                 // react->species_states[j][mc3d_indices[i]] += v_get_val(x,j);
@@ -439,8 +542,17 @@ void* ecs_do_reactions(void* dataptr) {
                     stop_idx = react->region_size - 1;
                     stop = FALSE;
                 }
+                /* a decomposed grid only advances the voxels of this rank */
+                start_idx = MAX(start_idx, react->owned_start);
+                stop_idx = MIN(stop_idx, react->owned_stop - 1);
                 if (react->num_species_involved == 0)
                     continue;
+                if (react->reaction_batch) {
+                    ecs_do_reaction_batch(react, start_idx, stop_idx, dt);
+                    if (stop)
+                        return NULL;
+                    continue;
+                }
                 /*allocate data structures*/
                 OcFullMatrix jacobian(react->num_species_involved, react->num_species_involved);
                 b.resize(react->num_species_involved);
@@ -483,40 +595,8 @@ void* ecs_do_reactions(void* dataptr) {
                         if (react->num_species_involved == 1) {
                             react->species_states[0][i] += b[0] / jacobian(0, 0);
                         } else {
-                            // find entry in leftmost column with largest absolute value
-                            // Pivot
-                            for (j = 0; j < react->num_species_involved; j++) {
-                                for (k = j + 1; k < react->num_species_involved; k++) {
-                                    if (abs(jacobian(j, j)) < abs(jacobian(k, j))) {
-                                        for (n = 0; n < react->num_species_involved; n++) {
-                                            temp = jacobian(j, n);
-                                            jacobian(j, n) = jacobian(k, n);
-                                            jacobian(k, n) = temp;
-                                        }
-                                    }
-                                }
-                            }
-
-                            for (j = 0; j < react->num_species_involved - 1; j++) {
-                                for (k = j + 1; k < react->num_species_involved; k++) {
-                                    ge_value = jacobian(k, j) / jacobian(j, j);
-                                    for (n = 0; n < react->num_species_involved; n++) {
-                                        val_to_set = jacobian(k, n) - ge_value * jacobian(j, n);
-                                        jacobian(k, n) = val_to_set;
-                                    }
-                                    b[k] = b[k] - ge_value * b[j];
-                                }
-                            }
-
-                            for (j = react->num_species_involved - 1; j + 1 > 0; j--) {
-                                x[j] = b[j];
-                                for (k = j + 1; k < react->num_species_involved; k++) {
-                                    if (k != j) {
-                                        x[j] = x[j] - jacobian(j, k) * x[k];
-                                    }
-                                }
-                                x[j] = x[j] / jacobian(j, j);
-                            }
+                            ecs_solve_reaction_jacobian(
+                                jacobian, b, x, react->num_species_involved);
                             for (j = 0; j < react->num_species_involved; j++) {
                                 // I think this should be something like
                                 // react->species_states[j][mc3d_indices[i]] += x[j];
@@ -679,6 +759,12 @@ void _rhs_variable_step_ecs(const double* states, double* ydot) {
         for (i = 0; i < grid_size; i++) {
             grid_states[i] = states[i];
         }
+        /* a decomposed grid only advances its slab, fetch the voxels read
+         * by the local segments from the ranks that own them */
+        g = dynamic_cast<ECS_Grid_node*>(grid);
+        if (g && g->decomposition) {
+            ecs_decomposition_readout(g, grid_states);
+        }
         states += grid_size;
     }
     /* transfer concentrations to classic NEURON states */
@@ -890,6 +976,7 @@ void _rhs_variable_step_helper(Grid_node* g, double const* const states, double*
 // p1 = b  p2 = states
 void ics_ode_solve(double dt, double* RHS, const double* states) {
     Grid_node* grid;
+    ECS_Grid_node* g;
     ssize_t i;
     int grid_size = 0;
     double* grid_states;
@@ -908,6 +995,12 @@ void ics_ode_solve(double dt, double* RHS, const double* states) {
         for (i = 0; i < grid_size; i++) {
             grid_states[i] = states[i];
         }
+        /* a decomposed grid only advances its slab, fetch the voxels read
+         * by the local segments from the ranks that own them */
+        g = dynamic_cast<ECS_Grid_node*>(grid);
+        if (g && g->decomposition) {
+            ecs_decomposition_readout(g, grid_states);
+        }
         states += grid_size;
     }
     /* transfer concentrations to classic NEURON states */
@@ -937,50 +1030,109 @@ void ics_ode_solve(double dt, double* RHS, const double* states) {
  *****************************************************************************/
 
 
-/* solve_dd_clhs_tridiag uses Thomas Algorithm to solves a
- * diagonally dominant tridiagonal matrix (Ax=b), where the
- * triple (lower, diagonal and upper) are repeated to form A.
- * N        -   length of the matrix
- * l_diag   -   lower diagonal
- * diag     -   diagonal
- * u_diag   -   upper diagonal
- * b        -   pointer to the RHS  (length N)
- * lbc_diag -   the lower boundary diagonal (the first diagonal element)
- * lbc_u_diag - the lower boundary upper diagonal (the first upper
- *              diagonal element)
- * ubc_l_diag - the upper boundary lower diagonal (the last lower
- *              diagonal element)
- * ubc_diag -   the upper boundary diagonal (the last diagonal element)
- * The solution (x) is stored in b.
- * c          - scratchpad array, N - 1 doubles long
+/* ecs_adi_factors factorizes the diagonally dominant tridiagonal matrix
+ * used by every line of one homogeneous DG-ADI sweep, where the triple
+ * (lower, diagonal and upper) is repeated to form the matrix and only the
+ * boundary rows differ. The Thomas algorithm eliminations depend only on
+ * the matrix, so they are done once per sweep rather than once per line.
+ * g        -   the parameters and state of the grid
+ * dir      -   the direction of the sweep
+ * dt       -   the time step
+ * N        -   length of the matrix (at least 2)
+ * c        -   the modified upper diagonal (length N - 1)
+ * d        -   the eliminated diagonal (length N)
+ * a        -   the lower diagonal of each row, a[0] is unused (length N)
  */
-static int solve_dd_clhs_tridiag(const int N,
-                                 const double l_diag,
-                                 const double diag,
-                                 const double u_diag,
-                                 const double lbc_diag,
-                                 const double lbc_u_diag,
-                                 const double ubc_l_diag,
-                                 const double ubc_diag,
-                                 double* const b,
-                                 double* const c) {
+void ecs_adi_factors(ECS_Grid_node* g,
+                     ECSAdiDirection* dir,
+                     const double dt,
+                     const int N,
+                     double* const c,
+                     double* const d,
+                     double* const a) {
     int i;
+    double r;
+    if (dir == g->ecs_adi_dir_x)
+        r = g->dc_x * dt / SQ(g->dx);
+    else if (dir == g->ecs_adi_dir_y)
+        r = g->dc_y * dt / SQ(g->dy);
+    else
+        r = g->dc_z * dt / SQ(g->dz);
+    const double l_diag = -r / 2.0;
+    const double diag = 1.0 + r;
+    const double u_diag = -r / 2.0;
+    double lbc_diag = 1.0, lbc_u_diag = 0, ubc_l_diag = 0, ubc_diag = 1.0;
+    if (g->bc->type == NEUMANN) {
+        lbc_diag = 1.0 + r / 2.0;
+        lbc_u_diag = -r / 2.0;
+        ubc_l_diag = -r / 2.0;
+        ubc_diag = 1.0 + r / 2.0;
+    }
 
-
+    d[0] = lbc_diag;
     c[0] = lbc_u_diag / lbc_diag;
-    b[0] = b[0] / lbc_diag;
-
     for (i = 1; i < N - 1; i++) {
-        c[i] = u_diag / (diag - l_diag * c[i - 1]);
-        b[i] = (b[i] - l_diag * b[i - 1]) / (diag - l_diag * c[i - 1]);
+        a[i] = l_diag;
+        d[i] = diag - l_diag * c[i - 1];
+        c[i] = u_diag / d[i];
+    }
+    a[N - 1] = ubc_l_diag;
+    d[N - 1] = ubc_diag - ubc_l_diag * c[N - 2];
+}
+
+/* ecs_solve_adi_lines solves ECS_ADI_LANES lines of one sweep at once with
+ * the factors from ecs_adi_factors. The right hand sides are interleaved so
+ * the inner loop runs across the lines and vectorizes; the divisions are
+ * the same as the scalar Thomas algorithm, so the results do not change.
+ * N        -   length of the lines
+ * nlines   -   the number of lines (at most ECS_ADI_LANES)
+ * lines    -   pointers to the right hand sides, the solutions are stored there
+ * c, d, a  -   the factors from ecs_adi_factors
+ * x        -   scratchpad array, N * ECS_ADI_LANES doubles long
+ */
+void ecs_solve_adi_lines(const int N,
+                         const int nlines,
+                         double* const* const lines,
+                         double const* const c,
+                         double const* const d,
+                         double const* const a,
+                         double* const x) {
+    int i, k;
+    for (k = 0; k < nlines; k++) {
+        for (i = 0; i < N; i++) {
+            x[i * ECS_ADI_LANES + k] = lines[k][i];
+        }
+    }
+    for (; k < ECS_ADI_LANES; k++) {
+        for (i = 0; i < N; i++) {
+            x[i * ECS_ADI_LANES + k] = 0;
+        }
     }
-    b[N - 1] = (b[N - 1] - ubc_l_diag * b[N - 2]) / (ubc_diag - ubc_l_diag * c[N - 2]);
 
+    for (k = 0; k < ECS_ADI_LANES; k++) {
+        x[k] = x[k] / d[0];
+    }
+    for (i = 1; i < N; i++) {
+        double* const xi = &x[i * ECS_ADI_LANES];
+        double const* const xp = &x[(i - 1) * ECS_ADI_LANES];
+        for (k = 0; k < ECS_ADI_LANES; k++) {
+            xi[k] = (xi[k] - a[i] * xp[k]) / d[i];
+        }
+    }
     /*back substitution*/
     for (i = N - 2; i >= 0; i--) {
-        b[i] = b[i] - c[i] * b[i + 1];
+        double* const xi = &x[i * ECS_ADI_LANES];
+        double const* const xn = &x[(i + 1) * ECS_ADI_LANES];
+        for (k = 0; k < ECS_ADI_LANES; k++) {
+            xi[k] = xi[k] - c[i] * xn[k];
+        }
+    }
+
+    for (k = 0; k < nlines; k++) {
+        for (i = 0; i < N; i++) {
+            lines[k][i] = x[i * ECS_ADI_LANES + k];
+        }
     }
-    return 0;
 }
 
 /*
@@ -1029,31 +1181,35 @@ ubc_diag, b, c);
 */
 
 
-/* dg_adi_x performs the first of 3 steps in DG-ADI
+/* ecs_dg_adi_x_range builds the right hand side of the first of 3 steps in
+ * DG-ADI for the voxels x_start <= x < x_stop of one line
  * g    -   the parameters and state of the grid
  * dt   -   the time step
  * y    -   the index for the y plane
  * z    -   the index for the z plane
- * state    -   where the output of this step is stored
- * scratch  - scratchpad array of doubles, length g->size_x - 1
+ * x_start, x_stop  -   the part of the line, state must be valid from
+ *                      x_start - 1 to x_stop
+ * state    -   the current state of the grid
+ * RHS  -   where the right hand side of the line is stored, indexed by x
+ * Returns 1 if the line still needs the tridiagonal solve.
  */
-static void ecs_dg_adi_x(ECS_Grid_node* g,
-                         const double dt,
-                         const int y,
-                         const int z,
-                         double const* const state,
-                         double* const RHS,
-                         double* const scratch) {
+int ecs_dg_adi_x_range(ECS_Grid_node* g,
+                       const double dt,
+                       const int y,
+                       const int z,
+                       const int x_start,
+                       const int x_stop,
+                       double const* const state,
+                       double* const RHS) {
     int yp, ym, zp, zm;
     int x;
-    double r = g->dc_x * dt / SQ(g->dx);
     double div_y, div_z;
     /*TODO: Get rid of this by not calling dg_adi when on the boundary for DIRICHLET conditions*/
     if (g->bc->type == DIRICHLET &&
         (y == 0 || z == 0 || y == g->size_y - 1 || z == g->size_z - 1)) {
-        for (x = 0; x < g->size_x; x++)
+        for (x = x_start; x < x_stop; x++)
             RHS[x] = g->bc->value;
-        return;
+        return 0;
     }
 
     if (g->size_y > 1) {
@@ -1077,16 +1233,20 @@ static void ecs_dg_adi_x(ECS_Grid_node* g,
 
     if (g->bc->type == NEUMANN) {
         /*zero flux boundary condition*/
-        RHS[0] = state[IDX(0, y, z)] + g->states_cur[IDX(0, y, z)] +
-                 dt *
-                     ((g->dc_y / SQ(g->dy)) *
-                          (state[IDX(0, yp, z)] - 2. * state[IDX(0, y, z)] + state[IDX(0, ym, z)]) /
-                          div_y +
-                      (g->dc_z / SQ(g->dz)) *
-                          (state[IDX(0, y, zp)] - 2. * state[IDX(0, y, z)] + state[IDX(0, y, zm)]) /
-                          div_z);
-        if (g->size_x > 1) {
-            RHS[0] += dt * (g->dc_x / SQ(g->dx)) * (state[IDX(1, y, z)] - state[IDX(0, y, z)]);
+        if (x_start == 0) {
+            RHS[0] = state[IDX(0, y, z)] + g->states_cur[IDX(0, y, z)] +
+                     dt * ((g->dc_y / SQ(g->dy)) *
+                               (state[IDX(0, yp, z)] - 2. * state[IDX(0, y, z)] +
+                                state[IDX(0, ym, z)]) /
+                               div_y +
+                           (g->dc_z / SQ(g->dz)) *
+                               (state[IDX(0, y, zp)] - 2. * state[IDX(0, y, z)] +
+                                state[IDX(0, y, zm)]) /
+                               div_z);
+            if (g->size_x > 1)
+                RHS[0] += dt * (g->dc_x / SQ(g->dx)) * (state[IDX(1, y, z)] - state[IDX(0, y, z)]);
+        }
+        if (g->size_x > 1 && x_stop == g->size_x) {
             x = g->size_x - 1;
             RHS[x] =
                 state[IDX(x, y, z)] + g->states_cur[IDX(x, y, z)] +
@@ -1099,10 +1259,12 @@ static void ecs_dg_adi_x(ECS_Grid_node* g,
                           div_z);
         }
     } else {
-        RHS[0] = g->bc->value;
-        RHS[g->size_x - 1] = g->bc->value;
+        if (x_start == 0)
+            RHS[0] = g->bc->value;
+        if (x_stop == g->size_x)
+            RHS[g->size_x - 1] = g->bc->value;
     }
-    for (x = 1; x < g->size_x - 1; x++) {
+    for (x = MAX(x_start, 1); x < MIN(x_stop, g->size_x - 1); x++) {
 #ifndef __PGI
         __builtin_prefetch(&(state[IDX(x + PREFETCH, y, z)]), 0, 1);
         __builtin_prefetch(&(state[IDX(x + PREFETCH, yp, z)]), 0, 0);
@@ -1122,22 +1284,26 @@ static void ecs_dg_adi_x(ECS_Grid_node* g,
                           div_z) +
                  g->states_cur[IDX(x, y, z)];
     }
-    if (g->size_x > 1) {
-        if (g->bc->type == NEUMANN)
-            solve_dd_clhs_tridiag(g->size_x,
-                                  -r / 2.0,
-                                  1.0 + r,
-                                  -r / 2.0,
-                                  1.0 + r / 2.0,
-                                  -r / 2.0,
-                                  -r / 2.0,
-                                  1.0 + r / 2.0,
-                                  RHS,
-                                  scratch);
-        else
-            solve_dd_clhs_tridiag(
-                g->size_x, -r / 2.0, 1.0 + r, -r / 2.0, 1.0, 0, 0, 1.0, RHS, scratch);
-    }
+    return g->size_x > 1;
+}
+
+
+/* dg_adi_x performs the first of 3 steps in DG-ADI
+ * g    -   the parameters and state of the grid
+ * dt   -   the time step
+ * y    -   the index for the y plane
+ * z    -   the index for the z plane
+ * state    -   the current state of the grid
+ * RHS  -   where the right hand side of the line is stored
+ * Returns 1 if the line still needs the tridiagonal solve.
+ */
+static int ecs_dg_adi_x(ECS_Grid_node* g,
+                        const double dt,
+                        const int y,
+                        const int z,
+                        double const* const state,
+                        double* const RHS) {
+    return ecs_dg_adi_x_range(g, dt, y, z, 0, g->size_x, state, RHS);
 }
 
 
@@ -1148,30 +1314,29 @@ static void ecs_dg_adi_x(ECS_Grid_node* g,
  * z    -   the index for the z plane
  * state    -   the values from the first step, which are
  *              overwritten by the output of this step
- * scratch  -   scratchpad array of doubles, length g->size_y - 1
+ * RHS  -   where the right hand side of the line is stored
+ * Returns 1 if the line still needs the tridiagonal solve.
  */
-static void ecs_dg_adi_y(ECS_Grid_node* g,
-                         double const dt,
-                         int const x,
-                         int const z,
-                         double const* const state,
-                         double* const RHS,
-                         double* const scratch) {
+static int ecs_dg_adi_y(ECS_Grid_node* g,
+                        double const dt,
+                        int const x,
+                        int const z,
+                        double const* const state,
+                        double* const RHS) {
     int y;
-    double r = (g->dc_y * dt / SQ(g->dy));
     /*TODO: Get rid of this by not calling dg_adi when on the boundary for DIRICHLET conditions*/
     if (g->bc->type == DIRICHLET &&
         (x == 0 || z == 0 || x == g->size_x - 1 || z == g->size_z - 1)) {
         for (y = 0; y < g->size_y; y++)
             RHS[y] = g->bc->value;
-        return;
+        return 0;
     }
     if (g->size_y == 1) {
         if (g->bc->type == NEUMANN)
             RHS[0] = state[x + z * g->size_x];
         else
             RHS[0] = g->bc->value;
-        return;
+        return 0;
     }
     if (g->bc->type == NEUMANN) {
         /*zero flux boundary condition*/
@@ -1201,19 +1366,7 @@ static void ecs_dg_adi_y(ECS_Grid_node* g,
                       g->states[IDX(x, y - 1, z)]) /
                      2.0;
     }
-    if (g->bc->type == NEUMANN)
-        solve_dd_clhs_tridiag(g->size_y,
-                              -r / 2.0,
-                              1.0 + r,
-                              -r / 2.0,
-                              1.0 + r / 2.0,
-                              -r / 2.0,
-                              -r / 2.0,
-                              1.0 + r / 2.0,
-                              RHS,
-                              scratch);
-    else
-        solve_dd_clhs_tridiag(g->size_y, -r / 2., 1. + r, -r / 2., 1.0, 0, 0, 1.0, RHS, scratch);
+    return 1;
 }
 
 
@@ -1224,23 +1377,22 @@ static void ecs_dg_adi_y(ECS_Grid_node* g,
  * y    -   the index for the y plane
  * state    -   the values from the second step, which are
  *              overwritten by the output of this step
- * scratch  -   scratchpad array of doubles, length g->size_z - 1
+ * RHS  -   where the right hand side of the line is stored
+ * Returns 1 if the line still needs the tridiagonal solve.
  */
-static void ecs_dg_adi_z(ECS_Grid_node* g,
-                         double const dt,
-                         int const x,
-                         int const y,
-                         double const* const state,
-                         double* const RHS,
-                         double* const scratch) {
+static int ecs_dg_adi_z(ECS_Grid_node* g,
+                        double const dt,
+                        int const x,
+                        int const y,
+                        double const* const state,
+                        double* const RHS) {
     int z;
-    double r = g->dc_z * dt / SQ(g->dz);
     /*TODO: Get rid of this by not calling dg_adi when on the boundary for DIRICHLET conditions*/
     if (g->bc->type == DIRICHLET &&
         (x == 0 || y == 0 || x == g->size_x - 1 || y == g->size_y - 1)) {
         for (z = 0; z < g->size_z; z++)
             RHS[z] = g->bc->value;
-        return;
+        return 0;
     }
 
     if (g->size_z == 1) {
@@ -1248,7 +1400,7 @@ static void ecs_dg_adi_z(ECS_Grid_node* g,
             RHS[0] = state[y + g->size_y * x];
         else
             RHS[0] = g->bc->value;
-        return;
+        return 0;
     }
 
     if (g->bc->type == NEUMANN) {
@@ -1277,19 +1429,7 @@ static void ecs_dg_adi_z(ECS_Grid_node* g,
                      2.;
     }
 
-    if (g->bc->type == NEUMANN)
-        solve_dd_clhs_tridiag(g->size_z,
-                              -r / 2.0,
-                              1.0 + r,
-                              -r / 2.0,
-                              1.0 + r / 2.0,
-                              -r / 2.0,
-                              -r / 2.0,
-                              1.0 + r / 2.0,
-                              RHS,
-                              scratch);
-    else
-        solve_dd_clhs_tridiag(g->size_z, -r / 2., 1. + r, -r / 2., 1.0, 0, 0, 1.0, RHS, scratch);
+    return 1;
 }
 
 static void* ecs_do_dg_adi(void* dataptr) {
@@ -1308,28 +1448,58 @@ static void* ecs_do_dg_adi(void* dataptr) {
     void (*ecs_dg_adi_dir)(
         ECS_Grid_node*, double, int, int, double const* const, double* const, double* const) =
         ecs_adi_dir->ecs_dg_adi_dir;
+    int (*ecs_dg_adi_rhs)(ECS_Grid_node*, double, int, int, double const* const, double* const) =
+        ecs_adi_dir->ecs_dg_adi_rhs;
+    if (ecs_dg_adi_rhs == NULL) {
+        for (k = start; k < stop; k++) {
+            i = k / sizej;
+            j = k % sizej;
+            ecs_dg_adi_dir(g, dt, i, j, state_in, &state_out[k * offset], scratchpad);
+        }
+        return NULL;
+    }
+
+    /* the homogeneous sweeps share one matrix, factorize it once and solve
+     * the lines in batches of ECS_ADI_LANES */
+    double* c = scratchpad;
+    double* d = c + offset;
+    double* a = d + offset;
+    double* batch = a + offset;
+    double* lines[ECS_ADI_LANES];
+    int nlines = 0;
+    if (offset > 1) {
+        ecs_adi_factors(g, ecs_adi_dir, dt, offset, c, d, a);
+    }
     for (k = start; k < stop; k++) {
         i = k / sizej;
         j = k % sizej;
-        ecs_dg_adi_dir(g, dt, i, j, state_in, &state_out[k * offset], scratchpad);
+        if (ecs_dg_adi_rhs(g, dt, i, j, state_in, &state_out[k * offset])) {
+            lines[nlines++] = &state_out[k * offset];
+            if (nlines == ECS_ADI_LANES) {
+                ecs_solve_adi_lines(offset, nlines, lines, c, d, a, batch);
+                nlines = 0;
+            }
+        }
+    }
+    if (nlines > 0) {
+        ecs_solve_adi_lines(offset, nlines, lines, c, d, a, batch);
     }
-
     return NULL;
 }
 
-void ecs_run_threaded_dg_adi(const int i,
-                             const int j,
-                             ECS_Grid_node* g,
-                             ECSAdiDirection* ecs_adi_dir,
-                             const int n) {
+/* ecs_run_threaded_dg_adi_lines runs the lines start <= k < stop of a sweep,
+ * where line k is (k / j, k % j), divided between the threads */
+void ecs_run_threaded_dg_adi_lines(const int start,
+                                   const int stop,
+                                   const int j,
+                                   ECS_Grid_node* g,
+                                   ECSAdiDirection* ecs_adi_dir) {
     int k;
-    /* when doing any given direction, the number of tasks is the product of the other two, so
-     * multiply everything then divide out the current direction */
-    const int tasks_per_thread = (g->size_x * g->size_y * g->size_z / n) / NUM_THREADS;
-    const int extra = (g->size_x * g->size_y * g->size_z / n) % NUM_THREADS;
+    const int tasks_per_thread = (stop - start) / NUM_THREADS;
+    const int extra = (stop - start) % NUM_THREADS;
 
-    g->ecs_tasks[0].start = 0;
-    g->ecs_tasks[0].stop = tasks_per_thread + (extra > 0);
+    g->ecs_tasks[0].start = start;
+    g->ecs_tasks[0].stop = start + tasks_per_thread + (extra > 0);
     g->ecs_tasks[0].sizej = j;
     g->ecs_tasks[0].ecs_adi_dir = ecs_adi_dir;
     for (k = 1; k < NUM_THREADS; k++) {
@@ -1338,7 +1508,7 @@ void ecs_run_threaded_dg_adi(const int i,
         g->ecs_tasks[k].sizej = j;
         g->ecs_tasks[k].ecs_adi_dir = ecs_adi_dir;
     }
-    g->ecs_tasks[NUM_THREADS - 1].stop = i * j;
+    g->ecs_tasks[NUM_THREADS - 1].stop = stop;
     /* launch threads */
     for (k = 0; k < NUM_THREADS - 1; k++) {
         TaskQueue_add_task(AllTasks, &ecs_do_dg_adi, &(g->ecs_tasks[k]), NULL);
@@ -1349,8 +1519,20 @@ void ecs_run_threaded_dg_adi(const int i,
     TaskQueue_sync(AllTasks);
 }
 
+/* when doing any given direction, the number of lines is the product of the other two */
+void ecs_run_threaded_dg_adi(const int i,
+                             const int j,
+                             ECS_Grid_node* g,
+                             ECSAdiDirection* ecs_adi_dir,
+                             const int) {
+    ecs_run_threaded_dg_adi_lines(0, i * j, j, g, ecs_adi_dir);
+}
+
 void ecs_set_adi_homogeneous(ECS_Grid_node* g) {
-    g->ecs_adi_dir_x->ecs_dg_adi_dir = ecs_dg_adi_x;
-    g->ecs_adi_dir_y->ecs_dg_adi_dir = ecs_dg_adi_y;
-    g->ecs_adi_dir_z->ecs_dg_adi_dir = ecs_dg_adi_z;
+    g->ecs_adi_dir_x->ecs_dg_adi_dir = NULL;
+    g->ecs_adi_dir_y->ecs_dg_adi_dir = NULL;
+    g->ecs_adi_dir_z->ecs_dg_adi_dir = NULL;
+    g->ecs_adi_dir_x->ecs_dg_adi_rhs = ecs_dg_adi_x;
+    g->ecs_adi_dir_y->ecs_dg_adi_rhs = ecs_dg_adi_y;
+    g->ecs_adi_dir_z->ecs_dg_adi_rhs = ecs_dg_adi_z;
 }
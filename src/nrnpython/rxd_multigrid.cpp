@@ -0,0 +1,366 @@
+#include <../../nrnconf.h>
+#include <stdio.h>
+#include <assert.h>
+#include <string.h>
+#include <algorithm>
+#include <cmath>
+#include <vector>
+#include "grids.h"
+#include "rxd.h"
+#include "nrnwrap_Python.h"
+
+/*****************************************************************************
+ *
+ * Geometric multigrid for homogeneous extracellular diffusion
+ *
+ * Solves (I - dt L) x = b on an ECS grid with constant diffusion coefficients,
+ * where L is the same 7 point Laplacian as the variable step right hand side
+ * (_rhs_variable_step_helper). With zero flux boundaries every voxel is an
+ * unknown and a missing neighbour contributes no flux. With Dirichlet
+ * boundaries the boundary voxels keep the value given in b and only the
+ * interior voxels are solved for.
+ *
+ * The solver is a flexible conjugate gradient iteration preconditioned by one
+ * V-cycle of cell centred multigrid. Coarse cells aggregate 2 fine cells along each
+ * axis that has more than one cell, the operator is rediscretized on every
+ * level, and the transfers are averaging and piecewise constant injection.
+ * The V-cycle uses red-black Gauss-Seidel, reversing the colour order after
+ * the coarse grid correction. The preconditioner is only symmetric when every
+ * coarse cell is full, so the Polak-Ribiere form of beta is used, which also
+ * converges for the uneven cells left by odd grid sizes.
+ *
+ *****************************************************************************/
+
+#define ECS_MG_SMOOTH        2
+#define ECS_MG_COARSE_SWEEPS 16
+#define ECS_MG_COARSEST      64
+/* stop when the residual is below RTOL of the right hand side, or below ATOL
+ * (mM) root mean square per voxel for a right hand side that is nearly 0 */
+#define ECS_MG_RTOL          1e-10
+#define ECS_MG_ATOL          1e-14
+#define ECS_MG_MAXITER       100
+
+struct ECSMultigridLevel {
+    int nx, ny, nz;
+    /* strides of the arrays, which have a halo of zeros around the grid so
+     * the stencil needs no tests at the edges */
+    size_t sx, sy;
+    /* whether each axis was coarsened going to the next level */
+    bool cx, cy, cz;
+    /* scale of dc/dx^2 relative to the finest level */
+    double scale_x, scale_y, scale_z;
+    std::vector<double> u, f, r;
+    size_t index(const int i, const int j, const int k) const {
+        return (i + 1) * sx + (j + 1) * sy + (k + 1);
+    }
+};
+
+struct ECSMultigrid {
+    /* the finest level are the unknowns, without the Dirichlet boundary */
+    std::vector<ECSMultigridLevel> levels;
+    /* the finest level vectors of the conjugate gradient */
+    std::vector<double> x, b, r, r_old, p, q;
+    bool dirichlet;
+    /* per axis coefficients of the finest level for the current dt */
+    double ax, ay, az;
+};
+
+static ECSMultigrid* ecs_multigrid_create(ECS_Grid_node* g) {
+    ECSMultigrid* mg = new ECSMultigrid;
+    mg->dirichlet = g->bc->type == DIRICHLET;
+    ECSMultigridLevel level;
+    level.nx = mg->dirichlet ? g->size_x - 2 : g->size_x;
+    level.ny = mg->dirichlet ? g->size_y - 2 : g->size_y;
+    level.nz = mg->dirichlet ? g->size_z - 2 : g->size_z;
+    level.scale_x = level.scale_y = level.scale_z = 1.0;
+    if (level.nx <= 0 || level.ny <= 0 || level.nz <= 0) {
+        /* every voxel is on the boundary */
+        return mg;
+    }
+    for (;;) {
+        size_t n = (size_t) level.nx * level.ny * level.nz;
+        level.sy = level.nz + 2;
+        level.sx = (level.ny + 2) * level.sy;
+        level.u.assign((level.nx + 2) * level.sx, 0.0);
+        level.f.assign(level.u.size(), 0.0);
+        level.r.assign(level.u.size(), 0.0);
+        level.cx = level.nx > 1;
+        level.cy = level.ny > 1;
+        level.cz = level.nz > 1;
+        bool coarsest = n <= ECS_MG_COARSEST || !(level.cx || level.cy || level.cz);
+        if (coarsest) {
+            level.cx = level.cy = level.cz = false;
+        }
+        mg->levels.push_back(level);
+        if (coarsest) {
+            break;
+        }
+        ECSMultigridLevel& fine = mg->levels.back();
+        ECSMultigridLevel coarse;
+        coarse.nx = fine.cx ? (fine.nx + 1) / 2 : fine.nx;
+        coarse.ny = fine.cy ? (fine.ny + 1) / 2 : fine.ny;
+        coarse.nz = fine.cz ? (fine.nz + 1) / 2 : fine.nz;
+        coarse.scale_x = fine.cx ? fine.scale_x / 4.0 : fine.scale_x;
+        coarse.scale_y = fine.cy ? fine.scale_y / 4.0 : fine.scale_y;
+        coarse.scale_z = fine.cz ? fine.scale_z / 4.0 : fine.scale_z;
+        level = coarse;
+    }
+    size_t n = mg->levels[0].u.size();
+    mg->x.assign(n, 0.0);
+    mg->b.assign(n, 0.0);
+    mg->r.assign(n, 0.0);
+    mg->r_old.assign(n, 0.0);
+    mg->p.assign(n, 0.0);
+    mg->q.assign(n, 0.0);
+    return mg;
+}
+
+void ecs_multigrid_free(ECSMultigrid* mg) {
+    delete mg;
+}
+
+/* the coefficients of one level, and the diagonal of row (i, j) away from the
+ * z edges; with zero flux boundaries a missing neighbour adds nothing to the
+ * diagonal, with Dirichlet boundaries it is a fixed boundary voxel */
+struct MGRow {
+    double ax, ay, az, diag;
+    MGRow(const ECSMultigrid* mg, const ECSMultigridLevel& l, const int i, const int j) {
+        ax = mg->ax * l.scale_x;
+        ay = mg->ay * l.scale_y;
+        az = mg->az * l.scale_z;
+        if (mg->dirichlet) {
+            diag = 1.0 + 2.0 * (ax + ay + az);
+        } else {
+            diag = 1.0 + ax * ((i > 0) + (i < l.nx - 1)) + ay * ((j > 0) + (j < l.ny - 1)) +
+                   2.0 * az;
+        }
+    }
+    double diag_at(const bool dirichlet, const ECSMultigridLevel& l, const int k) const {
+        return dirichlet ? diag : diag - az * ((k == 0) + (k == l.nz - 1));
+    }
+};
+
+/* out = A u on level l */
+static void mg_apply(const ECSMultigrid* mg,
+                     const ECSMultigridLevel& l,
+                     const double* u,
+                     double* out) {
+    const size_t sx = l.sx, sy = l.sy;
+    for (int i = 0; i < l.nx; i++) {
+        for (int j = 0; j < l.ny; j++) {
+            const MGRow row(mg, l, i, j);
+            const size_t base = l.index(i, j, 0);
+            for (int k = 0; k < l.nz; k++) {
+                const size_t idx = base + k;
+                out[idx] = row.diag_at(mg->dirichlet, l, k) * u[idx] -
+                           (row.ax * (u[idx - sx] + u[idx + sx]) +
+                            row.ay * (u[idx - sy] + u[idx + sy]) +
+                            row.az * (u[idx - 1] + u[idx + 1]));
+            }
+        }
+    }
+}
+
+/* one Gauss-Seidel sweep over the voxels of one colour */
+static void mg_smooth_colour(const ECSMultigrid* mg, ECSMultigridLevel& l, const int colour) {
+    const size_t sx = l.sx, sy = l.sy;
+    double* u = l.u.data();
+    const double* f = l.f.data();
+    for (int i = 0; i < l.nx; i++) {
+        for (int j = 0; j < l.ny; j++) {
+            const MGRow row(mg, l, i, j);
+            const size_t base = l.index(i, j, 0);
+            for (int k = (i + j + colour) & 1; k < l.nz; k += 2) {
+                const size_t idx = base + k;
+                u[idx] = (f[idx] + row.ax * (u[idx - sx] + u[idx + sx]) +
+                          row.ay * (u[idx - sy] + u[idx + sy]) +
+                          row.az * (u[idx - 1] + u[idx + 1])) /
+                         row.diag_at(mg->dirichlet, l, k);
+            }
+        }
+    }
+}
+
+static void mg_smooth(const ECSMultigrid* mg, ECSMultigridLevel& l, const int sweeps, bool rev) {
+    for (int s = 0; s < sweeps; s++) {
+        mg_smooth_colour(mg, l, rev ? 1 : 0);
+        mg_smooth_colour(mg, l, rev ? 0 : 1);
+    }
+}
+
+/* approximately solves A u = f on level n with a zero initial guess */
+static void mg_vcycle(ECSMultigrid* mg, const size_t n) {
+    ECSMultigridLevel& l = mg->levels[n];
+    std::fill(l.u.begin(), l.u.end(), 0.0);
+    if (n + 1 == mg->levels.size()) {
+        mg_smooth(mg, l, ECS_MG_COARSE_SWEEPS, false);
+        mg_smooth(mg, l, ECS_MG_COARSE_SWEEPS, true);
+        return;
+    }
+    ECSMultigridLevel& c = mg->levels[n + 1];
+    mg_smooth(mg, l, ECS_MG_SMOOTH, false);
+
+    /* restrict the residual by averaging the fine cells of each coarse cell */
+    mg_apply(mg, l, l.u.data(), l.r.data());
+    std::fill(c.f.begin(), c.f.end(), 0.0);
+    for (int i = 0; i < l.nx; i++) {
+        for (int j = 0; j < l.ny; j++) {
+            const size_t base = l.index(i, j, 0);
+            const size_t cbase = c.index(l.cx ? i / 2 : i, l.cy ? j / 2 : j, 0);
+            for (int k = 0; k < l.nz; k++) {
+                c.f[cbase + (l.cz ? k / 2 : k)] += l.f[base + k] - l.r[base + k];
+            }
+        }
+    }
+    for (int i = 0; i < c.nx; i++) {
+        const int nx = l.cx ? std::min(2, l.nx - 2 * i) : 1;
+        for (int j = 0; j < c.ny; j++) {
+            const int ny = l.cy ? std::min(2, l.ny - 2 * j) : 1;
+            const size_t cbase = c.index(i, j, 0);
+            for (int k = 0; k < c.nz; k++) {
+                const int nz = l.cz ? std::min(2, l.nz - 2 * k) : 1;
+                c.f[cbase + k] /= nx * ny * nz;
+            }
+        }
+    }
+
+    mg_vcycle(mg, n + 1);
+
+    /* piecewise constant correction */
+    for (int i = 0; i < l.nx; i++) {
+        for (int j = 0; j < l.ny; j++) {
+            const size_t base = l.index(i, j, 0);
+            const size_t cbase = c.index(l.cx ? i / 2 : i, l.cy ? j / 2 : j, 0);
+            for (int k = 0; k < l.nz; k++) {
+                l.u[base + k] += c.u[cbase + (l.cz ? k / 2 : k)];
+            }
+        }
+    }
+    mg_smooth(mg, l, ECS_MG_SMOOTH, true);
+}
+
+static double mg_dot(const std::vector<double>& a, const std::vector<double>& b) {
+    double s = 0;
+    for (size_t i = 0; i < a.size(); i++) {
+        s += a[i] * b[i];
+    }
+    return s;
+}
+
+/* ecs_multigrid_solve solves (I - dt L) x = b for the homogeneous grid g.
+ * x holds the initial guess on entry and may be the same array as b.
+ * Returns the number of iterations, or -1 if the tolerance was not reached.
+ */
+int ecs_multigrid_solve(ECS_Grid_node* g, const double dt, const double* b, double* x) {
+    if (g->multigrid == NULL) {
+        g->multigrid = ecs_multigrid_create(g);
+    }
+    ECSMultigrid* mg = g->multigrid;
+    const int size_x = g->size_x, size_y = g->size_y, size_z = g->size_z;
+    const size_t grid_size = (size_t) size_x * size_y * size_z;
+    if (mg->levels.empty()) {
+        if (x != b) {
+            memcpy(x, b, sizeof(double) * grid_size);
+        }
+        return 0;
+    }
+    ECSMultigridLevel& l = mg->levels[0];
+    const int off = mg->dirichlet ? 1 : 0;
+    mg->ax = size_x > 1 ? dt * g->dc_x / SQ(g->dx) : 0;
+    mg->ay = size_y > 1 ? dt * g->dc_y / SQ(g->dy) : 0;
+    mg->az = size_z > 1 ? dt * g->dc_z / SQ(g->dz) : 0;
+
+    /* gather the unknowns, the fixed Dirichlet boundary moves to the right
+     * hand side */
+    for (int i = 0; i < l.nx; i++) {
+        for (int j = 0; j < l.ny; j++) {
+            for (int k = 0; k < l.nz; k++) {
+                size_t idx = l.index(i, j, k);
+                size_t gidx = ((size_t) (i + off) * size_y + (j + off)) * size_z + (k + off);
+                mg->x[idx] = x[gidx];
+                mg->b[idx] = b[gidx];
+                if (mg->dirichlet) {
+                    if (i == 0)
+                        mg->b[idx] += mg->ax * b[gidx - size_y * size_z];
+                    if (i == l.nx - 1)
+                        mg->b[idx] += mg->ax * b[gidx + size_y * size_z];
+                    if (j == 0)
+                        mg->b[idx] += mg->ay * b[gidx - size_z];
+                    if (j == l.ny - 1)
+                        mg->b[idx] += mg->ay * b[gidx + size_z];
+                    if (k == 0)
+                        mg->b[idx] += mg->az * b[gidx - 1];
+                    if (k == l.nz - 1)
+                        mg->b[idx] += mg->az * b[gidx + 1];
+                }
+            }
+        }
+    }
+    if (mg->dirichlet && x != b) {
+        /* the boundary voxels keep their values */
+        for (int i = 0; i < size_x; i++) {
+            for (int j = 0; j < size_y; j++) {
+                for (int k = 0; k < size_z; k++) {
+                    if (i == 0 || j == 0 || k == 0 || i == size_x - 1 || j == size_y - 1 ||
+                        k == size_z - 1) {
+                        size_t gidx = ((size_t) i * size_y + j) * size_z + k;
+                        x[gidx] = b[gidx];
+                    }
+                }
+            }
+        }
+    }
+
+    /* preconditioned conjugate gradient */
+    int iter, result = -1;
+    const double bnorm = std::sqrt(mg_dot(mg->b, mg->b));
+    const double tol = std::max(ECS_MG_RTOL * bnorm,
+                                ECS_MG_ATOL * std::sqrt(double(l.nx) * l.ny * l.nz));
+    if (bnorm == 0) {
+        /* the solution is exactly 0, whatever the initial guess */
+        std::fill(mg->x.begin(), mg->x.end(), 0.);
+        result = 0;
+    } else {
+        mg_apply(mg, l, mg->x.data(), mg->r.data());
+        for (size_t i = 0; i < mg->r.size(); i++) {
+            mg->r[i] = mg->b[i] - mg->r[i];
+        }
+    }
+    double rz = 0;
+    for (iter = 0; result < 0 && iter < ECS_MG_MAXITER; iter++) {
+        if (std::sqrt(mg_dot(mg->r, mg->r)) <= tol) {
+            result = iter;
+            break;
+        }
+        l.f = mg->r;
+        mg_vcycle(mg, 0);
+        double rz_new = mg_dot(mg->r, l.u);
+        if (iter == 0) {
+            mg->p = l.u;
+        } else {
+            double beta = (rz_new - mg_dot(mg->r_old, l.u)) / rz;
+            for (size_t i = 0; i < mg->p.size(); i++) {
+                mg->p[i] = l.u[i] + beta * mg->p[i];
+            }
+        }
+        rz = rz_new;
+        mg->r_old = mg->r;
+        mg_apply(mg, l, mg->p.data(), mg->q.data());
+        double alpha = rz / mg_dot(mg->p, mg->q);
+        for (size_t i = 0; i < mg->x.size(); i++) {
+            mg->x[i] += alpha * mg->p[i];
+            mg->r[i] -= alpha * mg->q[i];
+        }
+    }
+
+    /* scatter the solution */
+    for (int i = 0; i < l.nx; i++) {
+        for (int j = 0; j < l.ny; j++) {
+            for (int k = 0; k < l.nz; k++) {
+                x[((size_t) (i + off) * size_y + (j + off)) * size_z + (k + off)] =
+                    mg->x[l.index(i, j, k)];
+            }
+        }
+    }
+    return result;
+}
@@ -20,6 +20,7 @@
 #include "options.h"
 #include "section.h"
 
+#include <algorithm>
 #include <cerrno>
 #include <cmath>
 #include <cstdio>
@@ -995,6 +996,249 @@ void hoc_varpush() {
     hoc_pushs((pc++)->sym);
 }
 
+/* Superinstructions, emitted by the parser in place of the first instruction
+   of a common sequence. The sequence keeps its length and its later
+   instructions, which are skipped, so jump offsets and code inspection (e.g.
+   hoc_get_symbol looking for hoc_eval) are unaffected. Anything but the plain
+   case falls back to the original instructions. */
+
+// plain scalar variable of the current object (or top level), no equation tracking
+static double* plain_var(Symbol* sym) {
+    if (sym->type != VAR || sym->cpublic == 2 || is_array(*sym) || hoc_do_equation) {
+        return nullptr;
+    }
+    switch (sym->subtype) {
+    case USERDOUBLE:
+        return sym->u.pval;
+    case NOTUSER:
+        return OPVAL(sym);
+    default:
+        return nullptr;
+    }
+}
+
+// varpush sym, eval
+void hoc_varpush_eval() {
+    Symbol* sym = pc->sym;
+    pc += 2;
+    if (double* pd = plain_var(sym)) {
+        hoc_pushx(*pd);
+    } else if (sym->type == AUTO) {
+        hoc_pushx(cast<double>(fp->argn[sym->u.u_auto]));
+    } else {
+        hoc_pushs(sym);
+        hoc_eval();
+    }
+}
+
+// varpush sym, assign op
+void hoc_varpush_assign() {
+    Symbol* sym = pc->sym;
+    double* pd;
+    if (pc[2].i == 0 && (pd = plain_var(sym))) {
+        pc += 3;
+        double d = hoc_xpop();
+        *pd = d;
+        hoc_pushx(d);
+    } else {
+        pc += 2;  // hoc_assign reads op
+        hoc_pushs(sym);
+        hoc_assign();
+    }
+}
+
+// constpush num, add (sub, mul, div)
+void hoc_constpush_add() {
+    double d2 = *(pc->sym->u.pnum);
+    pc += 2;
+    hoc_pushx(hoc_xpop() + d2);
+}
+
+void hoc_constpush_sub() {
+    double d2 = *(pc->sym->u.pnum);
+    pc += 2;
+    hoc_pushx(hoc_xpop() - d2);
+}
+
+void hoc_constpush_mul() {
+    double d2 = *(pc->sym->u.pnum);
+    pc += 2;
+    hoc_pushx(hoc_xpop() * d2);
+}
+
+void hoc_constpush_div() {
+    double d2 = *(pc->sym->u.pnum);
+    pc += 2;
+    if (d2 == 0.0)
+        hoc_execerror("division by zero", (char*) 0);
+    hoc_pushx(hoc_xpop() / d2);
+}
+
+namespace {
+// one step of the postfix program run by hoc_apply_func
+struct ApplyOp {
+    enum Kind { Arg, Const, Var, Add, Sub, Mul, Div, Pow, Neg, AddK, SubK, MulK, DivK, Bltin };
+    Kind kind;
+    double value{};
+    const double* pval{};
+    double (*fn)(double){};
+};
+
+// Translate the instructions of s, or return false if the body is not a
+// single return of an arithmetic expression in $1.
+bool apply_compile(Symbol* s, std::vector<ApplyOp>& prog, int& maxdepth) {
+    Proc* proc = s->u.u_proc;
+    if (s->type != FUNCTION || !proc || !proc->defn.in || proc->nauto) {
+        return false;
+    }
+    int depth = 0;
+    maxdepth = 0;
+    auto emit = [&](ApplyOp op, int pops, int pushes) {
+        if (depth < pops) {
+            return false;
+        }
+        depth += pushes - pops;
+        maxdepth = std::max(maxdepth, depth);
+        prog.push_back(op);
+        return true;
+    };
+    Inst* const end = proc->defn.in + proc->size;
+    for (Inst* p = proc->defn.in; p < end;) {
+        Pfrv const pf = (p++)->pf;
+        bool ok;
+        if (pf == hoc_funcret) {
+            return depth == 1;
+        } else if (pf == hoc_arg) {
+            ok = (p++)->i == 1 && emit({ApplyOp::Arg}, 0, 1);
+        } else if (pf == hoc_constpush) {
+            ok = emit({ApplyOp::Const, *(p++)->sym->u.pnum}, 0, 1);
+        } else if (pf == hoc_pushzero) {
+            ok = emit({ApplyOp::Const, 0.}, 0, 1);
+        } else if (pf == hoc_varpush_eval) {
+            const double* pd = plain_var(p->sym);
+            p += 2;
+            ok = pd && emit({ApplyOp::Var, 0., pd}, 0, 1);
+        } else if (pf == hoc_add || pf == hoc_sub || pf == hoc_mul || pf == hoc_div ||
+                   pf == hoc_power) {
+            auto const kind = pf == hoc_add   ? ApplyOp::Add
+                              : pf == hoc_sub ? ApplyOp::Sub
+                              : pf == hoc_mul ? ApplyOp::Mul
+                              : pf == hoc_div ? ApplyOp::Div
+                                              : ApplyOp::Pow;
+            ok = emit({kind}, 2, 1);
+        } else if (pf == hoc_constpush_add || pf == hoc_constpush_sub ||
+                   pf == hoc_constpush_mul || pf == hoc_constpush_div) {
+            auto const kind = pf == hoc_constpush_add   ? ApplyOp::AddK
+                              : pf == hoc_constpush_sub ? ApplyOp::SubK
+                              : pf == hoc_constpush_mul ? ApplyOp::MulK
+                                                        : ApplyOp::DivK;
+            double const value = *p->sym->u.pnum;
+            p += 2;
+            ok = emit({kind, value}, 1, 1);
+        } else if (pf == hoc_negate) {
+            ok = emit({ApplyOp::Neg}, 1, 1);
+        } else if (pf == hoc_bltin) {
+            ok = emit({ApplyOp::Bltin, 0., nullptr, (p++)->sym->u.ptr}, 1, 1);
+        } else {
+            ok = false;
+        }
+        if (!ok) {
+            return false;
+        }
+    }
+    return false;
+}
+}  // namespace
+
+/* x[i] = s(x[i]) for i < n without the interpreter, when s is a built in
+   function or a hoc func whose body is a single return of an arithmetic
+   expression in $1, numbers, plain variables and built in functions, e.g.
+   func f() { return a*sin($1)^2 + 1 }. The instructions are translated to a
+   small postfix program that runs per element without a hoc frame. Every
+   operation is the one the interpreter would perform, in the same order, so
+   results, warnings and errors are the same. Variables are resolved in the
+   context of ob, as hoc_call_objfunc would. Returns false, doing nothing, for
+   any other function.
+*/
+bool hoc_apply_func(Symbol* s, Object* ob, double* x, std::size_t n) {
+    if (s->type == BLTIN) {
+        for (std::size_t i = 0; i < n; ++i) {
+            x[i] = (*s->u.ptr)(x[i]);
+        }
+        return true;
+    }
+    std::vector<ApplyOp> prog;
+    int maxdepth;
+    Objectdata* obdsave = hoc_objectdata_save();
+    hoc_objectdata = ob ? ob->u.dataspace : hoc_top_level_data;
+    bool const ok = apply_compile(s, prog, maxdepth);
+    hoc_objectdata = hoc_objectdata_restore(obdsave);
+    if (!ok) {
+        return false;
+    }
+    std::vector<double> stack(maxdepth);
+    for (std::size_t i = 0; i < n; ++i) {
+        double* sp = stack.data();
+        for (auto const& op: prog) {
+            switch (op.kind) {
+            case ApplyOp::Arg:
+                *sp++ = x[i];
+                break;
+            case ApplyOp::Const:
+                *sp++ = op.value;
+                break;
+            case ApplyOp::Var:
+                *sp++ = *op.pval;
+                break;
+            case ApplyOp::Add:
+                --sp;
+                sp[-1] += sp[0];
+                break;
+            case ApplyOp::Sub:
+                --sp;
+                sp[-1] -= sp[0];
+                break;
+            case ApplyOp::Mul:
+                --sp;
+                sp[-1] *= sp[0];
+                break;
+            case ApplyOp::Div:
+                --sp;
+                if (sp[0] == 0.0)
+                    hoc_execerror("division by zero", (char*) 0);
+                sp[-1] /= sp[0];
+                break;
+            case ApplyOp::Pow:
+                --sp;
+                sp[-1] = hoc_Pow(sp[-1], sp[0]);
+                break;
+            case ApplyOp::Neg:
+                sp[-1] = -sp[-1];
+                break;
+            case ApplyOp::AddK:
+                sp[-1] += op.value;
+                break;
+            case ApplyOp::SubK:
+                sp[-1] -= op.value;
+                break;
+            case ApplyOp::MulK:
+                sp[-1] *= op.value;
+                break;
+            case ApplyOp::DivK:
+                if (op.value == 0.0)
+                    hoc_execerror("division by zero", (char*) 0);
+                sp[-1] /= op.value;
+                break;
+            case ApplyOp::Bltin:
+                sp[-1] = (*op.fn)(sp[-1]);
+                break;
+            }
+        }
+        x[i] = stack[0];
+    }
+    return true;
+}
+
 #define relative(pc) (pc + (pc)->i)
 
 void hoc_forcode(void) {
@@ -2533,9 +2777,12 @@ void hoc_execute(Inst* p) /* run the machine */
     Inst* pcsav;
 
     BBSPOLL
+    /* Every loop iteration and every procedure call comes through here, so
+       polling once per entry bounds the response to an interrupt without a
+       test on each instruction. */
+    if (hoc_intset)
+        hoc_execerror("interrupted", (char*) 0);
     for (pc = p; pc->in != STOP && !hoc_returning;) {
-        if (hoc_intset)
-            hoc_execerror("interrupted", (char*) 0);
         /* (*((pc++)->pf))(); DEC 5000 increments pc after the return!*/
         pcsav = pc++;
         (*((pcsav)->pf))();
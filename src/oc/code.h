@@ -17,6 +17,9 @@ extern void hoc_add(void), hoc_sub(void), hoc_mul(void), hoc_div(void), hoc_cycl
 void hoc_assign();
 extern void hoc_bltin(void), hoc_varpush(void), hoc_constpush(void), hoc_print(void),
     hoc_varread(void);
+extern void hoc_varpush_eval(void), hoc_varpush_assign(void);
+extern void hoc_constpush_add(void), hoc_constpush_sub(void), hoc_constpush_mul(void),
+    hoc_constpush_div(void);
 extern void hoc_prexpr(void), hoc_prstr(void), hoc_assstr(void), hoc_pushzero(void);
 extern void hoc_chk_sym_has_ndim(), hoc_chk_sym_has_ndim1(), hoc_chk_sym_has_ndim2();
 void hoc_eq();
@@ -46,6 +46,12 @@ void debugzz(Inst* p) {
         prcod(hoc_bltin, "BLTIN\n");
         prcod(hoc_varpush, "VARPUSH\n");
         prcod(hoc_constpush, "CONSTPUSH\n");
+        prcod(hoc_varpush_eval, "VARPUSH_EVAL\n");
+        prcod(hoc_varpush_assign, "VARPUSH_ASSIGN\n");
+        prcod(hoc_constpush_add, "CONSTPUSH_ADD\n");
+        prcod(hoc_constpush_sub, "CONSTPUSH_SUB\n");
+        prcod(hoc_constpush_mul, "CONSTPUSH_MUL\n");
+        prcod(hoc_constpush_div, "CONSTPUSH_DIV\n");
         prcod(hoc_pushzero, "PUSHZERO\n");
         prcod(hoc_print, "PRINT\n");
         prcod(hoc_varread, "VARREAD\n");
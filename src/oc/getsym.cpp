@@ -86,6 +86,9 @@ Psym* hoc_getsym(const char* cp) {
         hoc_execerror(s, " not a variable");
     }
     last[-3].in = STOP; /*before doing last EVAL*/
+    if (last[-5].pf == hoc_varpush_eval) {
+        last[-5].pf = hoc_varpush; /* leave the symbol on the stack */
+    }
     pcsav = hoc_pc;
     hoc_execute(sp->u.u_proc->defn.in);
     hoc_pc = pcsav;
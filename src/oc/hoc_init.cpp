@@ -306,6 +306,7 @@ void hoc_init(void) /* install constants and built-ins table */
     /* start symlist and top level the same list */
     hoc_top_level_symlist = hoc_symlist = (Symlist*) emalloc(sizeof(Symlist));
     hoc_symlist->first = hoc_symlist->last = (Symbol*) 0;
+    hoc_symlist->index = nullptr;
     hoc_install_hoc_obj();
 }
 
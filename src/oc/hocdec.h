@@ -22,6 +22,7 @@ struct Symbol;
 struct Arrayinfo;
 struct Proc;
 struct Symlist;
+struct SymlistIndex;
 struct cTemplate;
 union Objectdata;
 struct Object;
@@ -75,6 +76,7 @@ struct Proc {
 struct Symlist {
     Symbol* first;
     Symbol* last;
+    SymlistIndex* index; /* name lookup built on demand for long lists */
 };
 
 typedef char* Upoint;
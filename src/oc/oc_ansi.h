@@ -159,6 +159,7 @@ double hoc_call_func(Symbol*, int narg);
 void hoc_call_func_result_on_stack(Symbol* s, int narg);
 // call a fuction within the context of an object.
 double hoc_call_objfunc(Symbol*, int narg, Object*);
+bool hoc_apply_func(Symbol*, Object*, double* x, std::size_t n);
 extern double hoc_ac_;
 extern double hoc_epsilon;
 extern int nrn_inpython_;
@@ -407,6 +408,7 @@ int hoc_stacktype();
 int hoc_inside_stacktype(int);
 void hoc_link_symbol(Symbol*, Symlist*);
 void hoc_unlink_symbol(Symbol*, Symlist*);
+void hoc_symbol_rename(Symbol*, const char* name);
 void notify_freed(void*);
 void notify_pointer_freed(void*);
 int ivoc_list_look(Object*, Object*, char*, int);
@@ -12,6 +12,8 @@
 #include <cstdio>
 #include <cstdlib>
 #include <cstring>
+#include <string_view>
+#include <unordered_map>
 
 #if HAVE_MALLOC_H
 #include <malloc.h>
@@ -45,15 +47,65 @@ void print_symlist(const char* s, Symlist* tab) {
         }
 }
 
+/* Name -> first symbol of that name, for lists that are searched past
+   index_min_length symbols. Built lazily by hoc_table_lookup, kept up to date
+   by hoc_link_symbol and hoc_unlink_symbol, rebuilt after any
+   hoc_symbol_rename. Keys point at the symbol names.
+*/
+struct SymlistIndex {
+    std::unordered_map<std::string_view, Symbol*> map;
+    std::size_t rename_epoch;
+};
+
+static constexpr std::size_t index_min_length = 16;
+static std::size_t rename_epoch;
+
+static bool index_valid(Symlist* tab) {
+    if (!tab->index) {
+        return false;
+    }
+    if (tab->index->rename_epoch != rename_epoch) {
+        delete tab->index;
+        tab->index = nullptr;
+        return false;
+    }
+    return true;
+}
+
+static void index_build(Symlist* tab) {
+    tab->index = new SymlistIndex{};
+    tab->index->rename_epoch = rename_epoch;
+    for (Symbol* sp = tab->first; sp != nullptr; sp = sp->next) {
+        tab->index->map.try_emplace(sp->name, sp);
+    }
+}
+
 Symbol* hoc_table_lookup(const char* s, Symlist* tab) /* find s in specific table */
 {
-    if (tab)
-        for (Symbol* sp = tab->first; sp != nullptr; sp = sp->next) {
-            if (strcmp(sp->name, s) == 0) {
-                return sp;
-            }
+    if (!tab) {
+        return nullptr;
+    }
+    if (index_valid(tab)) {
+        auto const it = tab->index->map.find(s);
+        return it == tab->index->map.end() ? nullptr : it->second;
+    }
+    std::size_t n = 0;
+    Symbol* sp;
+    for (sp = tab->first; sp != nullptr; sp = sp->next, ++n) {
+        if (strcmp(sp->name, s) == 0) {
+            break;
         }
-    return nullptr;
+    }
+    if (n >= index_min_length) {
+        index_build(tab);
+    }
+    return sp;
+}
+
+void hoc_symbol_rename(Symbol* sp, const char* name) {
+    free(sp->name);
+    sp->name = strdup(name);
+    ++rename_epoch;
 }
 
 Symbol* hoc_lookup(const char* s) /* find s in symbol table */
@@ -92,6 +144,7 @@ Symbol* hoc_install(/* install s in the list symbol table */
     if (!(*list)) {
         *list = (Symlist*) emalloc(sizeof(Symlist));
         (*list)->first = (*list)->last = nullptr;
+        (*list)->index = nullptr;
     }
     hoc_link_symbol(sp, *list);
     switch (t) {
@@ -150,6 +203,19 @@ void hoc_unlink_symbol(Symbol* s, Symlist* list) {
         }
     }
     s->next = nullptr;
+    if (index_valid(list)) {
+        auto& map = list->index->map;
+        if (auto it = map.find(s->name); it != map.end() && it->second == s) {
+            // an earlier symbol of the same name is still in the list
+            map.erase(it);
+            for (Symbol* sp = list->first; sp != nullptr; sp = sp->next) {
+                if (strcmp(sp->name, s->name) == 0) {
+                    map.emplace(sp->name, sp);
+                    break;
+                }
+            }
+        }
+    }
 }
 
 void hoc_link_symbol(Symbol* sp, Symlist* list) {
@@ -161,6 +227,9 @@ void hoc_link_symbol(Symbol* sp, Symlist* list) {
     }
     list->last = sp;
     sp->next = nullptr;
+    if (index_valid(list)) {
+        list->index->map.try_emplace(sp->name, sp);
+    }
 }
 
 void hoc_free_symspace(Symbol* s1) { /* frees symbol space. Marks it UNDEF */
@@ -266,6 +335,7 @@ void hoc_free_list(Symlist** list) { /* free the space in a symbol table */
         free((char*) s1);
         s1 = s2;
     }
+    delete (*list)->index;
     free((char*) (*list));
     *list = nullptr;
 }
@@ -3,6 +3,7 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <InterViews/resource.h>
+#include <algorithm>
 #include "oc2iv.h"
 #include "bbs.h"
 #include "bbslocal.h"
@@ -19,6 +20,7 @@ bool BBSImpl::is_master_ = false;
 bool BBSImpl::started_ = false;
 bool BBSImpl::done_ = false;
 bool BBSImpl::master_works_ = true;
+int BBSImpl::job_batch_ = 1;
 
 #undef debug
 #define debug BBSImpl::debug_
@@ -179,6 +181,33 @@ std::vector<char> BBS::upkpickle() {
     return s;
 }
 
+std::size_t BBS::upkpickle_begin() {
+    auto n = impl_->upkpickle_begin();
+    if (debug) {
+        printf("upkpickle_begin %zu\n", n);
+    }
+    return n;
+}
+
+void BBS::upkpickle_part(char* s, std::size_t n) {
+    impl_->upkpickle_part(s, n);
+}
+
+std::size_t BBSImpl::upkpickle_begin() {
+    upk_pickle_ = upkpickle();
+    upk_pickle_pos_ = 0;
+    return upk_pickle_.size();
+}
+
+void BBSImpl::upkpickle_part(char* s, std::size_t n) {
+    assert(upk_pickle_pos_ + n <= upk_pickle_.size());
+    std::copy_n(upk_pickle_.data() + upk_pickle_pos_, n, s);
+    upk_pickle_pos_ += n;
+    if (upk_pickle_pos_ == upk_pickle_.size()) {
+        upk_pickle_.clear();
+    }
+}
+
 void BBS::pkbegin() {
     if (debug) {
         printf("pkbegin\n");
@@ -221,6 +250,21 @@ void BBS::pkpickle(const std::vector<char>& s) {
     impl_->pkpickle(s);
 }
 
+void BBS::pkpickle_parts(const std::vector<std::string_view>& parts) {
+    if (debug) {
+        printf("pkpickle_parts %zu parts\n", parts.size());
+    }
+    impl_->pkpickle_parts(parts);
+}
+
+void BBSImpl::pkpickle_parts(const std::vector<std::string_view>& parts) {
+    std::vector<char> s;
+    for (auto part: parts) {
+        s.insert(s.end(), part.begin(), part.end());
+    }
+    pkpickle(s);
+}
+
 #if 0
 // for now all todo messages are of the three item form
 // tid
@@ -330,6 +374,14 @@ void BBS::master_works(int flag) {
     }
 }
 
+void BBS::job_batch(int n) {
+    BBSImpl::job_batch_ = n;
+}
+
+int BBS::job_batch() {
+    return BBSImpl::job_batch_;
+}
+
 int BBSImpl::master_take_result(int pid) {
     assert(0);
     return 0;
@@ -20,6 +20,8 @@ class BBS {
     void upkvec(int n, double* px);  // n input px space must exist
     char* upkstr();                  // delete [] char* when finished
     std::vector<char> upkpickle();
+    std::size_t upkpickle_begin();
+    void upkpickle_part(char*, std::size_t);
 
     // before posting use these
     void pkbegin();
@@ -28,11 +30,14 @@ class BBS {
     void pkvec(int n, double* px);  // doesn't pack n
     void pkstr(const char*);
     void pkpickle(const std::vector<char>&);
+    void pkpickle_parts(const std::vector<std::string_view>&);
     void post(const char*);
 
     int submit(int userid);
     bool working(int& id, double& x, int& userid);
     void master_works(int flag);
+    void job_batch(int n);
+    int job_batch();
     void context();
 
     bool is_master();
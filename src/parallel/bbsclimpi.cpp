@@ -18,9 +18,12 @@ extern void nrnmpi_int_broadcast(int*, int, int);
 
 #define debug 0
 
+#include <deque>
 #include <map>
+#include <utility>
 
 class KeepArgs: public std::map<int, bbsmpibuf*> {};
+class TodoBatch: public std::deque<std::pair<int, bbsmpibuf*>> {};
 
 int BBSClient::sid_;
 
@@ -30,6 +33,8 @@ BBSClient::BBSClient() {
     request_ = nrnmpi_newbuf(100);
     nrnmpi_ref(request_);
     keepargs_ = new KeepArgs();
+    todo_batch_ = new TodoBatch();
+    results_ = nullptr;
     BBSClient::start();
 }
 
@@ -37,7 +42,12 @@ BBSClient::~BBSClient() {
     nrnmpi_unref(sendbuf_);
     nrnmpi_unref(recvbuf_);
     nrnmpi_unref(request_);
+    nrnmpi_unref(results_);
+    for (auto& t: *todo_batch_) {
+        nrnmpi_unref(t.second);
+    }
     delete keepargs_;
+    delete todo_batch_;
 }
 
 void BBSClient::perror(const char* s) {
@@ -73,13 +83,19 @@ char* BBSClient::upkstr() {
 }
 
 std::vector<char> BBSClient::upkpickle() {
-    std::size_t len{};
-    char* s = nrnmpi_upkpickle(&len, recvbuf_);
-    std::vector<char> ret(s, s + len);
-    delete[] s;
+    std::vector<char> ret(nrnmpi_upkpickle_size(recvbuf_));
+    nrnmpi_upkpickle_data(ret.data(), ret.size(), recvbuf_);
     return ret;
 }
 
+std::size_t BBSClient::upkpickle_begin() {
+    return nrnmpi_upkpickle_begin(recvbuf_);
+}
+
+void BBSClient::upkpickle_part(char* s, std::size_t n) {
+    nrnmpi_upkpickle_part(s, int(n), recvbuf_);
+}
+
 void BBSClient::pkbegin() {
     if (!sendbuf_) {
         sendbuf_ = nrnmpi_newbuf(100);
@@ -108,6 +124,17 @@ void BBSClient::pkpickle(const std::vector<char>& s) {
     nrnmpi_pkpickle(s.data(), s.size(), sendbuf_);
 }
 
+void BBSClient::pkpickle_parts(const std::vector<std::string_view>& parts) {
+    std::size_t size = 0;
+    for (auto part: parts) {
+        size += part.size();
+    }
+    nrnmpi_pkpickle_begin(size, sendbuf_);
+    for (auto part: parts) {
+        nrnmpi_pkpickle_part(part.data(), part.size(), sendbuf_);
+    }
+}
+
 void BBSClient::post(const char* key) {
 #if debug
     printf("%d BBSClient::post |%s|\n", nrnmpi_myid_bbs, key);
@@ -139,11 +166,35 @@ void BBSClient::post_result(int id) {
 #endif
     nrnmpi_enddata(sendbuf_);
     nrnmpi_pkint(id, sendbuf_);
-    nrnmpi_bbssend(sid_, POST_RESULT, sendbuf_);
+    if (todo_batch_->empty() && !results_) {
+        nrnmpi_bbssend(sid_, POST_RESULT, sendbuf_);
+    } else {
+        // results of a batch go back together when its last todo is done
+        if (!results_) {
+            results_ = nrnmpi_newbuf(100);
+            nrnmpi_ref(results_);
+            nrnmpi_pkbegin(results_);
+        }
+        nrnmpi_pkint(id, results_);
+        nrnmpi_pkbuf(sendbuf_, results_);
+        if (todo_batch_->empty()) {
+            flush_results();
+        }
+    }
     nrnmpi_unref(sendbuf_);
     sendbuf_ = nullptr;
 }
 
+void BBSClient::flush_results() {
+    if (results_) {
+        nrnmpi_pkint(0, results_);
+        nrnmpi_enddata(results_);
+        nrnmpi_bbssend(sid_, BATCH, results_);
+        nrnmpi_unref(results_);
+        results_ = nullptr;
+    }
+}
+
 int BBSClient::get(const char* key, int type) {
 #if debug
     printf("%d BBSClient::get |%s| type=%d\n", nrnmpi_myid_bbs, key, type);
@@ -169,6 +220,8 @@ int BBSClient::get(int key, int type) {
 int BBSClient::get(int type) {  // blocking
     fflush(stdout);
     fflush(stderr);
+    // a todo may wait on something that needs the results already computed
+    flush_results();
     double ts = time();
     nrnmpi_unref(recvbuf_);
     recvbuf_ = nrnmpi_newbuf(100);
@@ -215,8 +268,33 @@ void BBSClient::take(const char* key) {  // blocking
     upkbegin();
 }
 
+int BBSClient::next_todo() {
+    if (todo_batch_->empty()) {
+        return 0;
+    }
+    int id = todo_batch_->front().first;
+    nrnmpi_unref(recvbuf_);
+    recvbuf_ = todo_batch_->front().second;  // reference moves to recvbuf_
+    todo_batch_->pop_front();
+    upkbegin();
+    return id;
+}
+
+void BBSClient::unpack_batch() {
+    int id;
+    while ((id = nrnmpi_upkint(recvbuf_)) != 0) {
+        bbsmpibuf* buf = nrnmpi_upkbuf(recvbuf_);
+        nrnmpi_ref(buf);
+        todo_batch_->emplace_back(id, buf);
+    }
+}
+
 int BBSClient::look_take_todo() {
-    int type = get(0, LOOK_TAKE_TODO);
+    int type = next_todo();
+    if (type) {
+        return type;
+    }
+    type = get(0, LOOK_TAKE_TODO);
     if (type) {
         upkbegin();
     }
@@ -224,7 +302,10 @@ int BBSClient::look_take_todo() {
 }
 
 int BBSClient::take_todo() {
-    int type;
+    int type = next_todo();
+    if (type) {
+        return type;
+    }
     while ((type = get(0, TAKE_TODO)) == CONTEXT) {
         upkbegin();
         upkint();  // throw away userid
@@ -236,6 +317,10 @@ int BBSClient::take_todo() {
         execute_helper(-1);
     }
     upkbegin();
+    if (type == BATCH) {
+        unpack_batch();
+        type = next_todo();
+    }
     return type;
 }
 
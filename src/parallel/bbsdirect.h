@@ -29,6 +29,10 @@ class BBSDirect: public BBSImpl {
     void upkvec(int, double*) override;
     char* upkstr() override;  // delete [] char* when finished
     std::vector<char> upkpickle() override;
+#if NRNMPI
+    std::size_t upkpickle_begin() override;
+    void upkpickle_part(char*, std::size_t) override;
+#endif
 
     // before posting use these
     void pkbegin() override;
@@ -37,6 +41,9 @@ class BBSDirect: public BBSImpl {
     void pkvec(int, double*) override;
     void pkstr(const char*) override;
     void pkpickle(const std::vector<char>&) override;
+#if NRNMPI
+    void pkpickle_parts(const std::vector<std::string_view>&) override;
+#endif
     void post(const char*) override;
 
     void post_todo(int parentid) override;
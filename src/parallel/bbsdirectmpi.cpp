@@ -98,16 +98,22 @@ char* BBSDirect::upkstr() {
 }
 
 std::vector<char> BBSDirect::upkpickle() {
-    std::size_t n;
-    char* s = nrnmpi_upkpickle(&n, recvbuf_);
+    std::vector<char> ret(nrnmpi_upkpickle_size(recvbuf_));
+    nrnmpi_upkpickle_data(ret.data(), ret.size(), recvbuf_);
 #if debug
-    printf("upkpickle returning %d bytes\n", n);
+    printf("upkpickle returning %zu bytes\n", ret.size());
 #endif
-    std::vector<char> ret(s, s + n);
-    delete[] s;
     return ret;
 }
 
+std::size_t BBSDirect::upkpickle_begin() {
+    return nrnmpi_upkpickle_begin(recvbuf_);
+}
+
+void BBSDirect::upkpickle_part(char* s, std::size_t n) {
+    nrnmpi_upkpickle_part(s, int(n), recvbuf_);
+}
+
 void BBSDirect::pkbegin() {
 #if debug
     printf("%d BBSDirect::pkbegin\n", nrnmpi_myid_bbs);
@@ -153,6 +159,17 @@ void BBSDirect::pkpickle(const std::vector<char>& s) {
     nrnmpi_pkpickle(s.data(), s.size(), sendbuf_);
 }
 
+void BBSDirect::pkpickle_parts(const std::vector<std::string_view>& parts) {
+    std::size_t size = 0;
+    for (auto part: parts) {
+        size += part.size();
+    }
+    nrnmpi_pkpickle_begin(size, sendbuf_);
+    for (auto part: parts) {
+        nrnmpi_pkpickle_part(part.data(), part.size(), sendbuf_);
+    }
+}
+
 void BBSDirect::post(const char* key) {
 #if debug
     printf("%d BBSDirect::post |%s|\n", nrnmpi_myid_bbs, key);
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <cstddef>
+#include <string_view>
 #include <vector>
 
 class BBSImpl {
@@ -17,6 +19,10 @@ class BBSImpl {
     virtual void upkvec(int, double*) = 0;
     virtual char* upkstr() = 0;  // delete [] char* when finished
     virtual std::vector<char> upkpickle() = 0;
+    // a pickle in consecutive parts whose sizes add up to the size returned
+    // by upkpickle_begin, by default through upkpickle()
+    virtual std::size_t upkpickle_begin();
+    virtual void upkpickle_part(char*, std::size_t);
 
     // before posting use these
     virtual void pkbegin() = 0;
@@ -25,6 +31,8 @@ class BBSImpl {
     virtual void pkvec(int, double*) = 0;
     virtual void pkstr(const char*) = 0;
     virtual void pkpickle(const std::vector<char>&) = 0;
+    // the same as pkpickle of the concatenated parts
+    virtual void pkpickle_parts(const std::vector<std::string_view>&);
     virtual void post(const char*) = 0;
 
     virtual void post_todo(int parentid) = 0;
@@ -57,11 +65,14 @@ class BBSImpl {
     double integ_time_;
     double send_time_;
     std::vector<char> pickle_ret_;
+    std::vector<char> upk_pickle_;  // for the default upkpickle_part
+    std::size_t upk_pickle_pos_{};
     static bool is_master_;
     static bool started_, done_;
     static int mytid_;
     static int debug_;
     static bool master_works_;
+    static int job_batch_;  // most todo sent to a worker at once
 
   protected:
     std::vector<char> execute_helper(int id, bool exec = true);  // involves hoc specific details in
@@ -1,6 +1,5 @@
 #include <../../nrnconf.h>
 #include <stdio.h>
-#include <string.h>
 #include "bbslsrv.hpp"
 #include "oc_ansi.h"
 
@@ -10,9 +9,11 @@
 #define VECTOR 4
 #define PICKLE 5
 
+#include <deque>
 #include <map>
 #include <set>
 #include <string>
+#include <unordered_map>
 
 // debug is 0 1 or 2
 #define debug 0
@@ -27,24 +28,12 @@ class WorkItem {
     bool todo_less_than(const WorkItem*) const;
 };
 
-struct ltstr {
-    bool operator()(const char* s1, const char* s2) const {
-        return strcmp(s1, s2) < 0;
-    }
-};
-
 struct ltWorkItem {
     bool operator()(const WorkItem* w1, const WorkItem* w2) const {
         return w1->todo_less_than(w2);
     }
 };
 
-static char* newstr(const char* s) {
-    char* s1 = new char[strlen(s) + 1];
-    strcpy(s1, s);
-    return s1;
-}
-
 
 WorkItem::WorkItem(int id, MessageValue* m) {
 #if debug == 2
@@ -79,8 +68,8 @@ bool WorkItem::todo_less_than(const WorkItem* w) const {
     return w1->id_ < w2->id_;
 }
 
-class MessageList: public std::multimap<const char*, const MessageValue*, ltstr> {};
-class WorkList: public std::map<int, const WorkItem*> {};
+class MessageList: public std::unordered_map<std::string, std::deque<MessageValue*>> {};
+class WorkList: public std::unordered_map<int, const WorkItem*> {};
 class ReadyList: public std::set<WorkItem*, ltWorkItem> {};
 class ResultList: public std::multimap<int, const WorkItem*> {};
 
@@ -187,10 +176,11 @@ BBSLocalServer::~BBSLocalServer() {
 bool BBSLocalServer::look_take(const char* key, MessageValue** val) {
     MessageList::iterator m = messages_->find(key);
     if (m != messages_->end()) {
-        *val = const_cast<MessageValue*>((*m).second);
-        char* s = (char*) ((*m).first);
-        messages_->erase(m);
-        delete[] s;
+        *val = m->second.front();
+        m->second.pop_front();
+        if (m->second.empty()) {
+            messages_->erase(m);
+        }
 #if debug
         printf("srvr_look_take |%s|\n", key);
 #endif
@@ -205,7 +195,7 @@ bool BBSLocalServer::look_take(const char* key, MessageValue** val) {
 bool BBSLocalServer::look(const char* key, MessageValue** val) {
     MessageList::iterator m = messages_->find(key);
     if (m != messages_->end()) {
-        *val = const_cast<MessageValue*>((*m).second);
+        *val = m->second.front();
         Resource::ref(*val);
 #if debug
         printf("srvr_look true |%s|\n", key);
@@ -221,7 +211,7 @@ bool BBSLocalServer::look(const char* key, MessageValue** val) {
 }
 
 void BBSLocalServer::post(const char* key, MessageValue* val) {
-    messages_->emplace(newstr(key), val);
+    (*messages_)[key].push_back(val);
     Resource::ref(val);
 #if debug
     printf("srvr_post |%s|\n", key);
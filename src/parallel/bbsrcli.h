@@ -3,6 +3,7 @@
 #include <nrnmpiuse.h>
 #include "bbsimpl.h"
 class KeepArgs;
+class TodoBatch;
 struct bbsmpibuf;
 
 class BBSClient: public BBSImpl {  // implemented as PVM Client
@@ -20,6 +21,10 @@ class BBSClient: public BBSImpl {  // implemented as PVM Client
     void upkvec(int, double*) override;
     char* upkstr() override;  // delete [] char* when finished
     std::vector<char> upkpickle() override;
+#if NRNMPI
+    std::size_t upkpickle_begin() override;
+    void upkpickle_part(char*, std::size_t) override;
+#endif
 
     // before posting use these
     void pkbegin() override;
@@ -28,6 +33,9 @@ class BBSClient: public BBSImpl {  // implemented as PVM Client
     void pkvec(int, double*) override;
     void pkstr(const char*) override;
     void pkpickle(const std::vector<char>&) override;
+#if NRNMPI
+    void pkpickle_parts(const std::vector<std::string_view>&) override;
+#endif
     void post(const char*) override;
 
     void post_todo(int parentid) override;
@@ -54,6 +62,11 @@ class BBSClient: public BBSImpl {  // implemented as PVM Client
     void upkbegin();
     char* getkey();
     int getid();
+    int next_todo();  // id of the next todo of the last batch, or 0
+    void unpack_batch();
+    void flush_results();
     bbsmpibuf *sendbuf_, *recvbuf_, *request_;
+    TodoBatch* todo_batch_;
+    bbsmpibuf* results_;  // results of a batch not yet sent
 #endif
 };
@@ -5,6 +5,7 @@
 #define LOOK             2
 #define LOOK_TAKE        3
 #define TAKE             4
+#define BATCH            5  // several todo to a worker or results to the master
 #define LOOK_YES         6
 #define LOOK_NO          7
 #define LOOK_TAKE_YES    8
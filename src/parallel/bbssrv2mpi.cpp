@@ -15,8 +15,12 @@ void nrnbbs_context_wait();
 
 BBSDirectServer* BBSDirectServer::server_;
 
+#include <algorithm>
+#include <deque>
 #include <map>
 #include <set>
+#include <string>
+#include <unordered_map>
 
 #define debug 0
 
@@ -39,24 +43,12 @@ class WorkItem {
     bool todo_less_than(const WorkItem*) const;
 };
 
-struct ltstr {
-    bool operator()(const char* s1, const char* s2) const {
-        return strcmp(s1, s2) < 0;
-    }
-};
-
 struct ltWorkItem {
     bool operator()(const WorkItem* w1, const WorkItem* w2) const {
         return w1->todo_less_than(w2);
     }
 };
 
-static char* newstr(const char* s) {
-    char* s1 = new char[strlen(s) + 1];
-    strcpy(s1, s);
-    return s1;
-}
-
 WorkItem::WorkItem(int id, bbsmpibuf* buf, int cid) {
 #if debug == 2
     printf("WorkItem %d\n", id);
@@ -89,9 +81,10 @@ bool WorkItem::todo_less_than(const WorkItem* w) const {
     return w1->id_ < w2->id_;
 }
 
-class MessageList: public std::multimap<const char*, bbsmpibuf*, ltstr> {};
-class PendingList: public std::multimap<const char*, const int, ltstr> {};
-class WorkList: public std::map<int, const WorkItem*> {};
+// messages and pending takes with the same key are served first in first out
+class MessageList: public std::unordered_map<std::string, std::deque<bbsmpibuf*>> {};
+class PendingList: public std::unordered_map<std::string, std::deque<int>> {};
+class WorkList: public std::unordered_map<int, const WorkItem*> {};
 class LookingToDoList: public std::set<int> {};
 class ReadyList: public std::set<const WorkItem*, ltWorkItem> {};
 class ResultList: public std::multimap<int, const WorkItem*> {};
@@ -131,11 +124,11 @@ bool BBSDirectServer::look_take(const char* key, bbsmpibuf** recv) {
     MessageList::iterator m = messages_->find(key);
     if (m != messages_->end()) {
         b = true;
-        *recv = (*m).second;
-        // printf("free %d\n", buf);
-        char* s = (char*) ((*m).first);
-        messages_->erase(m);
-        delete[] s;
+        *recv = m->second.front();
+        m->second.pop_front();
+        if (m->second.empty()) {
+            messages_->erase(m);
+        }
     }
 #if debug
     printf("DirectServer::look_take |%s| recv=%p return %d\n", key, (*recv), b);
@@ -153,7 +146,7 @@ bool BBSDirectServer::look(const char* key, bbsmpibuf** recv) {
     MessageList::iterator m = messages_->find(key);
     if (m != messages_->end()) {
         b = true;
-        *recv = (*m).second;
+        *recv = m->second.front();
         if (*recv) {
             nrnmpi_ref(*recv);
         }
@@ -168,21 +161,21 @@ void BBSDirectServer::put_pending(const char* key, int cid) {
 #if debug
     printf("put_pending |%s| %d\n", key, cid);
 #endif
-    char* s = newstr(key);
-    pending_->emplace(s, cid);
+    (*pending_)[key].push_back(cid);
 }
 
 bool BBSDirectServer::take_pending(const char* key, int* cid) {
     bool b = false;
     PendingList::iterator p = pending_->find(key);
     if (p != pending_->end()) {
-        *cid = (*p).second;
+        *cid = p->second.front();
 #if debug
         printf("take_pending |%s| %d\n", key, *cid);
 #endif
-        char* s = (char*) ((*p).first);
-        pending_->erase(p);
-        delete[] s;
+        p->second.pop_front();
+        if (p->second.empty()) {
+            pending_->erase(p);
+        }
         b = true;
     }
     return b;
@@ -196,7 +189,7 @@ void BBSDirectServer::post(const char* key, bbsmpibuf* send) {
     if (take_pending(key, &cid)) {
         nrnmpi_bbssend(cid, TAKE, send);
     } else {
-        messages_->emplace(newstr(key), send);
+        (*messages_)[key].push_back(send);
         nrnmpi_ref(send);
     }
 }
@@ -342,6 +335,26 @@ int BBSDirectServer::look_take_todo(bbsmpibuf** recv) {
     }
 }
 
+int BBSDirectServer::look_take_todos(int n, bbsmpibuf* send) {
+    // leave enough for the other workers so the farm ends together
+    n = std::min(n, std::max(1, int(todo_->size()) / nrnmpi_numprocs_bbs));
+    int cnt = 0;
+    ReadyList::iterator i;
+    while (cnt < n && (i = todo_->begin()) != todo_->end()) {
+        WorkItem* w = (WorkItem*) (*i);
+        todo_->erase(i);
+        nrnmpi_pkint(w->id_, send);
+        nrnmpi_pkbuf(w->buf_, send);
+        nrnmpi_unref(w->buf_);
+        w->buf_ = nullptr;
+        ++cnt;
+    }
+#if debug
+    printf("DirectServer::look_take_todos n=%d return %d\n", n, cnt);
+#endif
+    return cnt;
+}
+
 int BBSDirectServer::look_take_result(int pid, bbsmpibuf** recv) {
 #if debug
     printf("DirectServer::look_take_result pid=%d\n", pid);
@@ -35,6 +35,7 @@ class BBSDirectServer {
     bool send_context(int cid);  // sends if not sent already
     void post_result(int id, bbsmpibuf*);
     int look_take_todo(bbsmpibuf**);
+    int look_take_todos(int n, bbsmpibuf*);  // packs id, todo pairs. returns count
     int look_take_result(int parentid, bbsmpibuf**);
     void context_wait();
 
@@ -7,6 +7,7 @@
 #endif
 #include "bbssrv2mpi.h"
 #include "bbssrv.h"
+#include "bbsimpl.h"
 
 #define debug 0
 
@@ -89,6 +90,16 @@ void BBSDirectServer::handle1(int size, int tag, int cid) {
 #endif
         BBSDirectServer::server_->post_result(index, recv);
         break;
+    case BATCH:
+#if debug
+        printf("handle BATCH of results from %x when cross=%g\n", cid, hoc_cross_x_);
+#endif
+        while ((index = nrnmpi_upkint(recv)) != 0) {
+            send = nrnmpi_upkbuf(recv);
+            BBSDirectServer::server_->post_result(index, send);
+        }
+        send = nullptr;
+        break;
     case POST:
         key = nrnmpi_getkey(recv);
 #if debug
@@ -178,6 +189,24 @@ void BBSDirectServer::handle1(int size, int tag, int cid) {
 #endif
             break;
         }
+        if (BBSImpl::job_batch_ > 1) {
+            send = nrnmpi_newbuf(100);
+            nrnmpi_ref(send);
+            nrnmpi_pkbegin(send);
+            index = BBSDirectServer::server_->look_take_todos(BBSImpl::job_batch_, send);
+            if (index) {
+#if debug
+                printf("handle sending back %d todo\n", index);
+#endif
+                nrnmpi_pkint(0, send);
+                nrnmpi_enddata(send);
+                nrnmpi_bbssend(cid, BATCH + 1, send);
+            } else {
+                BBSDirectServer::server_->add_looking_todo(cid);
+            }
+            nrnmpi_unref(send);
+            break;
+        }
         index = BBSDirectServer::server_->look_take_todo(&send);
         if (index) {
 #if debug
@@ -10,6 +10,7 @@
 #include "section.h"
 #include "membfunc.h"
 #include "multicore.h"
+#include "neuron/cache/model_data.hpp"
 #include "nrnpy.h"
 #include "utils/profile/profiler_interface.h"
 #include "node_order_optim/node_order_optim.h"
@@ -22,7 +23,7 @@
 extern int vector_arg_px(int, double**);
 Symbol* hoc_which_template(Symbol*);
 extern double t;
-extern void nrnmpi_source_var(), nrnmpi_target_var(), nrnmpi_setup_transfer();
+extern void nrnmpi_source_var(), nrnmpi_target_var(), nrnmpi_setup_transfer(int lag);
 extern int nrnmpi_spike_compress(int nspike, bool gid_compress, int xchng_meth);
 extern int nrnmpi_splitcell_connect(int that_host);
 extern int nrnmpi_multisplit(Section*, double x, int sid, int backbonestyle);
@@ -111,14 +112,16 @@ static int submit_help(OcBBS* bbs) {
             bbs->pkstr(gargstr(i++));
         } else {
             Object* ob = *hoc_objgetarg(i++);
-            std::vector<char> pname{};
-            if (neuron::python::methods.po2pickle) {
-                pname = neuron::python::methods.po2pickle(ob);
+            bool pickled = false;
+            if (neuron::python::methods.po2pickle_parts) {
+                pickled = neuron::python::methods.po2pickle_parts(
+                    ob, [bbs](const std::vector<std::string_view>& parts) {
+                        bbs->pkint(3);  // pyfun, arg1, ... style
+                        bbs->pkpickle_parts(parts);
+                    });
             }
-            if (!pname.empty()) {
+            if (pickled) {
                 style = 3;
-                bbs->pkint(style);  // pyfun, arg1, ... style
-                bbs->pkpickle(pname);
             } else {
                 style = 2;
                 bbs->pkint(style);  // [object],"fname", arg1, ... style
@@ -149,10 +152,14 @@ static int submit_help(OcBBS* bbs) {
         if (hoc_is_str_arg(i)) {
             bbs->pkint(0);  // hoc statement style
             bbs->pkstr(gargstr(i));
-        } else if (neuron::python::methods.po2pickle) {
-            auto pname = neuron::python::methods.po2pickle(*hoc_objgetarg(i));
+        } else if (neuron::python::methods.po2pickle_parts) {
             bbs->pkint(3);  // pyfun with no arg style
-            bbs->pkpickle(pname);
+            if (!neuron::python::methods.po2pickle_parts(
+                    *hoc_objgetarg(i), [bbs](const std::vector<std::string_view>& parts) {
+                        bbs->pkpickle_parts(parts);
+                    })) {
+                bbs->pkpickle({});
+            }
             bbs->pkint(0);  // argtypes
         }
     }
@@ -248,6 +255,14 @@ static double master_works(void* v) {
     return 0.;
 }
 
+static double job_batch(void* v) {
+    OcBBS* bbs = (OcBBS*) v;
+    if (ifarg(1)) {
+        bbs->job_batch(int(chkarg(1, 1, 1e6)));
+    }
+    return bbs->job_batch();
+}
+
 static double done(void* v) {
     OcBBS* bbs = (OcBBS*) v;
     bbs->done();
@@ -271,8 +286,12 @@ static void pack_help(int i, OcBBS* bbs) {
             bbs->pkint(n);
             bbs->pkvec(n, px);
         } else {  // must be a PythonObject
-            auto s = neuron::python::methods.po2pickle(*hoc_objgetarg(i));
-            bbs->pkpickle(s);
+            if (!neuron::python::methods.po2pickle_parts(
+                    *hoc_objgetarg(i), [bbs](const std::vector<std::string_view>& parts) {
+                        bbs->pkpickle_parts(parts);
+                    })) {
+                bbs->pkpickle({});
+            }
         }
     }
 }
@@ -354,9 +373,10 @@ static Object** upkvec(void* v) {
 
 static Object** upkpyobj(void* v) {
     OcBBS* bbs = (OcBBS*) v;
-    std::vector<char> s = bbs->upkpickle();
-    assert(neuron::python::methods.pickle2po);
-    Object* po = neuron::python::methods.pickle2po(s);
+    assert(neuron::python::methods.upkpickle2po);
+    std::size_t n = bbs->upkpickle_begin();
+    Object* po = neuron::python::methods.upkpickle2po(
+        n, [bbs](char* s, std::size_t k) { bbs->upkpickle_part(s, k); });
     return hoc_temp_objptr(po);
 }
 
@@ -461,7 +481,10 @@ static double vtransfer_time(void* v) {
 }
 
 static double mech_time(void* v) {
-    if (ifarg(1)) {
+    if (ifarg(1) && *getarg(1) == -1.) {
+        delete[] nrn_mech_wtime_;
+        nrn_mech_wtime_ = nullptr;
+    } else if (ifarg(1)) {
         if (nrn_mech_wtime_) {
             int i = (int) chkarg(1, 0, n_memb_func - 1);
             return nrn_mech_wtime_[i];
@@ -705,7 +728,8 @@ static double target_var(void*) {  // &target_variable, source_global_index
 }
 
 static double setup_transfer(void*) {  // after all source/target and before init and run
-    nrnmpi_setup_transfer();
+    // optional arg 1 lags the interprocessor transfer of the fixed step by dt
+    nrnmpi_setup_transfer(ifarg(1) ? int(chkarg(1, 0, 1)) : 0);
     return 0.;
 }
 
@@ -985,6 +1009,21 @@ static double print_memory_stats(void*) {
     return 1.0;
 }
 
+static double sort_stats(void*) {
+    auto const& stats = neuron::cache::last_sort;
+    if (ifarg(1)) {
+        IvocVect* vec = vector_arg(1);
+        vector_resize(vec, 5);
+        double* px = vector_vec(vec);
+        px[0] = double(stats.nodes);
+        px[1] = double(stats.mechanisms_sorted);
+        px[2] = double(stats.mechanisms_reused);
+        px[3] = stats.seconds;
+        px[4] = double(stats.generation);
+    }
+    return stats.seconds;
+}
+
 static double nrncorewrite_argappend(void*) {
     if (ifarg(2) && !hoc_is_double_arg(2)) {
         hoc_execerror(
@@ -1033,6 +1072,7 @@ static Member_func members[] = {{"submit", submit},
                                 {"look_take", look_take},
                                 {"runworker", worker},
                                 {"master_works_on_jobs", master_works},
+                                {"job_batch", job_batch},
                                 {"done", done},
                                 {"id", nrn_rank},
                                 {"nhost", nhost},
@@ -1098,6 +1138,7 @@ static Member_func members[] = {{"submit", submit},
                                 {"nrnbbcore_register_mapping", nrnbbcore_register_mapping},
                                 {"nrncore_run", nrncorerun},
                                 {"print_memory_stats", print_memory_stats},
+                                {"sort_stats", sort_stats},
 
                                 {0, 0}};
 
@@ -1279,14 +1320,20 @@ std::vector<char> BBSImpl::execute_helper(int id, bool exec) {
                 }
                 hoc_pushobj(vec->temp_objvar());
             } else {  // PythonObject
-                auto s = upkpickle();
-                int size = static_cast<int>(s.size());
+                Object* po;
                 if (subworld) {
+                    auto s = upkpickle();
+                    int size = static_cast<int>(s.size());
                     nrnmpi_int_broadcast(&size, 1, 0);
                     nrnmpi_char_broadcast(s.data(), size, 0);
+                    assert(neuron::python::methods.pickle2po);
+                    po = neuron::python::methods.pickle2po(s);
+                } else {
+                    assert(neuron::python::methods.upkpickle2po);
+                    std::size_t n = upkpickle_begin();
+                    po = neuron::python::methods.upkpickle2po(
+                        n, [this](char* s, std::size_t k) { upkpickle_part(s, k); });
                 }
-                assert(neuron::python::methods.pickle2po);
-                Object* po = neuron::python::methods.pickle2po(s);
                 hoc_pushobj(hoc_temp_objptr(po));
             }
         }
@@ -0,0 +1,138 @@
+// NOTE: this assumes neuronapi.h is on your CPLUS_INCLUDE_PATH
+#include "neuronapi.h"
+
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <exception>
+#include <iostream>
+#include <string>
+#include <vector>
+
+using std::cout;
+using std::endl;
+
+extern "C" void modl_reg(){/* No modl_reg */};
+
+constexpr int N = 20000;
+
+static void check(bool ok, const char* what) {
+    if (!ok) {
+        std::cerr << "FAILED: " << what << std::endl;
+        std::exit(1);
+    }
+}
+
+static double seconds_since(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+int main(void) {
+    static std::array<const char*, 4> argv = {"batch", "-nogui", "-nopython", nullptr};
+    nrn_init(3, argv.data());
+    Symbol* hh = nrn_symbol("hh");
+    Symbol* gnabar = nrn_symbol("gnabar_hh");
+    Symbol* v = nrn_symbol("v");
+    Symbol* diam = nrn_symbol("diam");
+
+    // a binary tree, one call at a time
+    auto start = std::chrono::steady_clock::now();
+    std::vector<Section*> single(N);
+    for (int i = 0; i < N; ++i) {
+        single[i] = nrn_section_new(("single_" + std::to_string(i)).c_str());
+        if (i) {
+            nrn_section_connect(single[i], 0, single[(i - 1) / 2], 1);
+        }
+        nrn_mechanism_insert(single[i], hh);
+        nrn_rangevar_set(gnabar, single[i], 0.5, 0.1 + 1e-6 * i);
+    }
+    double const t_single = seconds_since(start);
+
+    // the same tree in batches
+    start = std::chrono::steady_clock::now();
+    std::vector<int> parent(N);
+    std::vector<double> xs(N, 0.5), values(N);
+    for (int i = 0; i < N; ++i) {
+        parent[i] = (i - 1) / 2;
+        values[i] = 0.1 + 1e-6 * i;
+    }
+    parent[0] = -1;
+    std::vector<Section*> batch(N);
+    nrn_section_new_array("batch", N, parent.data(), nullptr, batch.data());
+    double t_batch = seconds_since(start);
+    // the list is an input here, as a model would have it, so not timed
+    Object* sl = nrn_object_new(nrn_symbol("SectionList"), 0);
+    for (Section* sec: batch) {
+        nrn_section_push(sec);
+        nrn_method_call(sl, nrn_method_symbol(sl, "append"), 0);
+        nrn_double_pop();
+        nrn_section_pop();
+    }
+    start = std::chrono::steady_clock::now();
+    nrn_mechanism_insert_sectionlist(nrn_sectionlist_data(sl), hh);
+    nrn_rangevar_set_array(gnabar, N, batch.data(), xs.data(), values.data());
+    t_batch += seconds_since(start);
+    cout << "build " << N << " sections: single " << t_single << " s, batch " << t_batch << " s"
+         << endl;
+
+    // same topology and parameters
+    check(std::string(nrn_secname(batch[5])) == "batch[5]", "section names");
+    // parents that form a loop, here 1 and 2, are refused before any section exists
+    bool refused = false;
+    try {
+        std::vector<int> loop{-1, 2, 1};
+        std::vector<Section*> secs(loop.size());
+        nrn_section_new_array("loop", loop.size(), loop.data(), nullptr, secs.data());
+    } catch (std::exception const&) {
+        refused = true;
+    }
+    check(refused, "parent loop");
+    bool same_distance = true;
+    for (int i = 1; i < N; ++i) {
+        same_distance = same_distance && nrn_distance(single[0], 0, single[i], 1) ==
+                                             nrn_distance(batch[0], 0, batch[i], 1);
+    }
+    check(same_distance, "topology");
+    std::vector<double> got(N);
+    nrn_rangevar_get_array(gnabar, N, single.data(), xs.data(), got.data());
+    check(got == values, "gnabar_hh");
+
+    // v and diam, through the per node path
+    for (int i = 0; i < N; ++i) {
+        values[i] = -70 + 1e-3 * i;
+    }
+    nrn_rangevar_set_array(v, N, batch.data(), xs.data(), values.data());
+    nrn_rangevar_get_array(v, N, batch.data(), xs.data(), got.data());
+    check(got == values, "v");
+    std::fill(values.begin(), values.end(), 2.);
+    nrn_rangevar_set_array(diam, N, batch.data(), xs.data(), values.data());
+    check(nrn_segment_diam_get(batch[N - 1], 0.5) == 2., "diam");
+    // pt3dconst keeps diam, as for hoc assignment
+    nrn_hoc_call("pt3dconst(1)");
+    std::fill(values.begin(), values.end(), 3.);
+    nrn_rangevar_set_array(diam, N, batch.data(), xs.data(), values.data());
+    check(nrn_segment_diam_get(batch[N - 1], 0.5) == 2., "diam with pt3dconst");
+    nrn_hoc_call("pt3dconst(0)");
+
+    // whole list reads, sized by a first call
+    nrn_nseg_set(batch[1], 3);
+    int const n = nrn_rangevar_get_sectionlist(v, nrn_sectionlist_data(sl), nullptr);
+    check(n == N + 2, "number of segments");
+    nrn_double_push(-65);
+    nrn_function_call(nrn_symbol("finitialize"), 1);
+    nrn_double_pop();
+    std::vector<double> all(n), m(n);
+    start = std::chrono::steady_clock::now();
+    nrn_rangevar_get_sectionlist(v, nrn_sectionlist_data(sl), all.data());
+    nrn_rangevar_get_sectionlist(nrn_symbol("m_hh"), nrn_sectionlist_data(sl), m.data());
+    double const t_read = seconds_since(start);
+    cout << "read v and m_hh at " << n << " segments: " << t_read << " s" << endl;
+    check(all == std::vector<double>(n, -65.), "v after finitialize");
+    check(m[0] == nrn_rangevar_get(nrn_symbol("m_hh"), batch[0], 0.5), "m_hh of batch[0]");
+    check(m[2] == nrn_rangevar_get(nrn_symbol("m_hh"), batch[1], 0.5), "m_hh of batch[1]");
+    check(std::fabs(m[0] - 0.0529) < 1e-3, "m_hh steady state");
+
+    nrn_object_unref(sl);
+    return 0;
+}
@@ -0,0 +1,56 @@
+"""Peak resident memory of the direct (in memory) transfer to CoreNEURON.
+
+    python direct_transfer_rss.py [ncell] [nseg]
+
+Builds ncell cells of nseg segments with hh and pas, then runs them with
+CoreNEURON in direct mode. The high water mark of the process is printed
+after the NEURON model is built and again after pc.psolve, which includes
+the transfer and the CoreNEURON model. The difference is what the transfer
+costs. Run it in a fresh process on the builds to compare; ru_maxrss only
+ever grows, so one process can only measure one transfer.
+"""
+
+import resource
+import sys
+
+from neuron import coreneuron, h
+
+
+def maxrss_mb():
+    # kilobytes on Linux, bytes on macOS
+    scale = 1 << 20 if sys.platform == "darwin" else 1 << 10
+    return resource.getrusage(resource.RUSAGE_SELF).ru_maxrss / scale
+
+
+def main(ncell=2000, nseg=101):
+    h.load_file("stdrun.hoc")
+    pc = h.ParallelContext()
+    cells = []
+    for gid in range(ncell):
+        sec = h.Section(name=f"cell{gid}")
+        sec.L, sec.diam, sec.nseg = 1000, 2, nseg
+        sec.insert("hh")
+        sec.insert("pas")
+        pc.set_gid2node(gid, pc.id())
+        pc.cell(gid, h.NetCon(sec(0.5)._ref_v, None, sec=sec))
+        cells.append(sec)
+    h.cvode.cache_efficient(1)
+    h.finitialize(-65)
+    built = maxrss_mb()
+
+    coreneuron.enable = True
+    coreneuron.verbose = 0
+    pc.set_maxstep(10)
+    h.stdinit()
+    pc.psolve(1)
+    transferred = maxrss_mb()
+    nmech = ncell * nseg
+    print(f"{ncell} cells, {nmech} hh and pas instances")
+    print(f"peak RSS after building: {built:.1f} MB")
+    print(f"peak RSS after psolve:   {transferred:.1f} MB")
+    print(f"transfer and CoreNEURON model: {transferred - built:.1f} MB")
+    pc.gid_clear()
+
+
+if __name__ == "__main__":
+    main(*(int(arg) for arg in sys.argv[1:3]))
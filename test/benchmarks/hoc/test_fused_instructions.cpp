@@ -0,0 +1,71 @@
+#include "code.h"
+#include "hocdec.h"
+#include "oc_ansi.h"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <chrono>
+#include <iostream>
+#include <string>
+
+/* @brief
+ *  Fused interpreter instructions (varpush+eval, varpush+assign and
+ *  constpush+arithmetic): a loop of scalar arithmetic is timed as compiled,
+ *  and again after its instructions are rewritten back to the unfused
+ *  first instruction of each sequence, which the interpreter still executes
+ *  since the rest of the sequence stays in the code stream.
+ */
+
+namespace {
+double time_ms(const std::string& stmt) {
+    auto start = std::chrono::high_resolution_clock::now();
+    REQUIRE(hoc_oc((stmt + "\n").c_str()) == 0);
+    auto end = std::chrono::high_resolution_clock::now();
+    return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+// replace the fused instructions of a func or proc by the unfused ones, returns how many
+int unfuse(const char* name) {
+    Symbol* sym = hoc_lookup(name);
+    REQUIRE(sym);
+    Inst* in = sym->u.u_proc->defn.in;
+    int n = 0;
+    for (unsigned long i = 0; i < sym->u.u_proc->size; ++i) {
+        Pfrv& pf = in[i].pf;
+        if (pf == hoc_varpush_eval || pf == hoc_varpush_assign) {
+            pf = hoc_varpush;
+            ++n;
+        } else if (pf == hoc_constpush_add || pf == hoc_constpush_sub ||
+                   pf == hoc_constpush_mul || pf == hoc_constpush_div) {
+            pf = hoc_constpush;
+            ++n;
+        }
+    }
+    return n;
+}
+}  // namespace
+
+TEST_CASE("Fused interpreter instructions", "[NEURON][hoc_interpreter][benchmark]") {
+    constexpr int niter = 2000000;
+    REQUIRE(hoc_oc("fused_g = 0\n"
+                   "func fused_loop() {local i, s, t\n"
+                   "  s = 0\n"
+                   "  t = 1\n"
+                   "  for i = 1, $1 {\n"
+                   "    t = t * 0.5 + 1\n"
+                   "    s = s + t - 2 + i / 4\n"
+                   "    fused_g = fused_g + 1\n"
+                   "  }\n"
+                   "  return s\n"
+                   "}\n") == 0);
+    auto const n = std::to_string(niter);
+    double const t_fused = time_ms("hoc_ac_ = fused_loop(" + n + ")");
+    double const fused = hoc_ac_;
+    REQUIRE(unfuse("fused_loop") > 0);
+    double const t_unfused = time_ms("hoc_ac_ = fused_loop(" + n + ")");
+    REQUIRE(hoc_ac_ == fused);
+    REQUIRE(hoc_oc("hoc_ac_ = fused_g\n") == 0);
+    REQUIRE(hoc_ac_ == 2. * niter);
+    std::cout << niter << " iterations of scalar arithmetic: fused " << t_fused
+              << " ms, unfused " << t_unfused << " ms, speedup " << t_unfused / t_fused << "\n";
+}
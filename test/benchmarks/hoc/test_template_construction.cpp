@@ -0,0 +1,62 @@
+#include "code.h"
+#include "oc_ansi.h"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <chrono>
+#include <iostream>
+#include <string>
+
+/* @brief
+ *  Construction of a template with many members: every member reference in
+ *  the template body and every obj.member access from the top level is a
+ *  symbol table lookup, so this is dominated by lookup cost in long
+ *  template and top level symbol tables.
+ */
+
+namespace {
+double time_ms(const std::string& stmt) {
+    auto start = std::chrono::high_resolution_clock::now();
+    REQUIRE(hoc_oc((stmt + "\n").c_str()) == 0);
+    auto end = std::chrono::high_resolution_clock::now();
+    return std::chrono::duration<double, std::milli>(end - start).count();
+}
+}  // namespace
+
+TEST_CASE("Template heavy model construction", "[NEURON][hoc_interpreter][benchmark]") {
+    constexpr int nmember = 400;
+    constexpr int ncell = 2000;
+    // many public members, the last ones referenced in init()
+    std::string tmpl{"begintemplate ManyMembers\npublic "};
+    for (int i = 0; i < nmember; ++i) {
+        tmpl += (i ? ", m" : "m") + std::to_string(i);
+    }
+    tmpl += "\n";
+    for (int i = 0; i < nmember; ++i) {
+        tmpl += "m" + std::to_string(i) + " = 0\n";
+    }
+    tmpl += "proc init() {\n";
+    for (int i = nmember - 20; i < nmember; ++i) {
+        tmpl += "  m" + std::to_string(i) + " = $1 + " + std::to_string(i) + "\n";
+    }
+    tmpl += "}\nendtemplate ManyMembers\n";
+    // and a long top level symbol table
+    for (int i = 0; i < 2000; ++i) {
+        tmpl += "toplevel_var" + std::to_string(i) + " = " + std::to_string(i) + "\n";
+    }
+    REQUIRE(hoc_oc(tmpl.c_str()) == 0);
+    auto const n = std::to_string(ncell);
+    REQUIRE(hoc_oc(("objref cells[" + n + "]\n").c_str()) == 0);
+
+    double const t_new = time_ms("for i = 0, " + n + " - 1 cells[i] = new ManyMembers(i)");
+    double const t_access = time_ms(
+        "s = 0\n"
+        "for i = 0, " +
+        n + " - 1 { cells[i].m" + std::to_string(nmember - 1) +
+        " += toplevel_var1999 s += cells[i].m" + std::to_string(nmember - 1) + " }");
+    REQUIRE(hoc_oc("hoc_ac_ = s\n") == 0);
+    double const last = nmember - 1;
+    REQUIRE(hoc_ac_ == ncell * (last + 1999.) + ncell * (ncell - 1) / 2.);
+    std::cout << ncell << " ManyMembers (" << nmember << " members): construct " << t_new
+              << " ms, member access " << t_access << " ms\n";
+}
@@ -0,0 +1,37 @@
+#include "code.h"
+#include "oc_ansi.h"
+#include "neuron/container/memory_usage.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <iostream>
+#include <string>
+
+/* @brief
+ *  Memory of the mechanism cache, which keeps the pdata pointers of every
+ *  mechanism instance (e.g. the ion variables of hh), for a model of many
+ *  hh segments. The numbers, and the print_local_memory_usage() table,
+ *  are printed so that builds can be compared.
+ */
+
+TEST_CASE("Mechanism cache memory usage", "[NEURON][memory][benchmark]") {
+    constexpr int nsec = 2000;
+    constexpr int nseg = 51;
+    REQUIRE(hoc_oc(("create msec[" + std::to_string(nsec) +
+                    "]\n"
+                    "forsec \"msec\" { nseg = " +
+                    std::to_string(nseg) +
+                    "  insert hh }\n"
+                    "finitialize(-65)\n")
+                       .c_str()) == 0);
+    auto const usage = neuron::container::local_memory_usage();
+    auto const& cached = usage.cache_model.mechanisms;
+    REQUIRE(cached.size > 0);
+    REQUIRE(cached.size <= cached.capacity);
+    std::cout << nsec * nseg << " hh instances: cache::Model mechanisms "
+              << neuron::container::format_memory(cached.size) << " ("
+              << double(cached.size) / (nsec * nseg) << " bytes per instance), capacity "
+              << neuron::container::format_memory(cached.capacity) << "\n";
+    REQUIRE(hoc_oc("print_local_memory_usage()\n") == 0);
+    REQUIRE(hoc_oc("forsec \"msec\" delete_section()\n") == 0);
+}
@@ -0,0 +1,63 @@
+#include "code.h"
+#include "oc_ansi.h"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <chrono>
+#include <iostream>
+#include <string>
+
+/* @brief
+ *  SectionList.getrange and setrange against the interpreted loop over the
+ *  segments that they replace, for a mechanism variable of many sections.
+ *  The values read and written both ways are checked to agree.
+ */
+
+namespace {
+double hoc_value(const std::string& expr) {
+    REQUIRE(hoc_oc(("hoc_ac_ = " + expr + "\n").c_str()) == 0);
+    return hoc_ac_;
+}
+
+double time_ms(const std::string& stmt) {
+    auto start = std::chrono::high_resolution_clock::now();
+    REQUIRE(hoc_oc((stmt + "\n").c_str()) == 0);
+    auto end = std::chrono::high_resolution_clock::now();
+    return std::chrono::duration<double, std::milli>(end - start).count();
+}
+}  // namespace
+
+TEST_CASE("SectionList range variable access", "[NEURON][seclist][benchmark]") {
+    constexpr int nsec = 2000;
+    constexpr int nseg = 51;
+    auto const n = std::to_string(nsec);
+    REQUIRE(hoc_oc(("create rsec[" + n +
+                    "]\n"
+                    "objref rsl, vloop, vbulk\n"
+                    "rsl = new SectionList()\n"
+                    "forsec \"rsec\" { nseg = " +
+                    std::to_string(nseg) +
+                    "  insert hh  rsl.append() }\n"
+                    "vloop = new Vector()\n"
+                    "vbulk = new Vector()\n")
+                       .c_str()) == 0);
+    // distinct values at every segment
+    REQUIRE(hoc_oc("i = 0\n"
+                   "forsec rsl for (x, 0) { gnabar_hh(x) = 0.1 + 1e-7 * i  i += 1 }\n") == 0);
+
+    double const t_loop_get = time_ms("vloop.resize(0)\n"
+                                      "forsec rsl for (x, 0) vloop.append(gnabar_hh(x))");
+    double const t_bulk_get = time_ms("rsl.getrange(\"gnabar_hh\", vbulk)");
+    REQUIRE(hoc_value("vbulk.size") == nsec * nseg);
+    REQUIRE(hoc_value("vbulk.eq(vloop)") == 1);
+
+    REQUIRE(hoc_oc("vbulk.mul(2)\n") == 0);
+    double const t_loop_set = time_ms("i = 0\n"
+                                      "forsec rsl for (x, 0) { gnabar_hh(x) = vbulk.x[i]  i += 1 }");
+    double const t_bulk_set = time_ms("rsl.setrange(\"gnabar_hh\", vbulk)");
+    REQUIRE(hoc_value("rsl.getrange(\"gnabar_hh\").eq(vbulk)") == 1);
+
+    std::cout << nsec * nseg << " segments: get loop " << t_loop_get << " ms, getrange "
+              << t_bulk_get << " ms; set loop " << t_loop_set << " ms, setrange " << t_bulk_set
+              << " ms\n";
+}
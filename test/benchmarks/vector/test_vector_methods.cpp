@@ -0,0 +1,126 @@
+#include "code.h"
+#include "oc_ansi.h"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <chrono>
+#include <iostream>
+#include <string>
+
+/* @brief
+ *  Vector method kernels (sort, sortindex, where, indvwhere, histogram,
+ *  spikebin, apply):
+ *  * results are checked against interpreted reference loops on a
+ *    moderate size, including ties, -0 and values on the comparison bounds
+ *  * the methods are then timed on a large vector
+ */
+
+namespace {
+double hoc_value(const std::string& expr) {
+    REQUIRE(hoc_oc(("hoc_ac_ = " + expr + "\n").c_str()) == 0);
+    return hoc_ac_;
+}
+
+double time_ms(const std::string& stmt) {
+    auto start = std::chrono::high_resolution_clock::now();
+    REQUIRE(hoc_oc((stmt + "\n").c_str()) == 0);
+    auto end = std::chrono::high_resolution_clock::now();
+    return std::chrono::duration<double, std::milli>(end - start).count();
+}
+}  // namespace
+
+TEST_CASE("Vector method kernels", "[NEURON][vector][benchmark]") {
+    REQUIRE(hoc_oc("objref vr, vs, vi, vw, vref, rn\n"
+                   "rn = new Random(1)\n"
+                   "rn.discunif(-20, 20)\n"
+                   "vr = new Vector(100000)\n"
+                   "vr.setrand(rn)\n"
+                   "vr.mul(0.25)\n"
+                   "vr.x[7] = -0\n"
+                   "vref = new Vector()\n") == 0);
+    SECTION("sort and sortindex match a stable comparison sort") {
+        REQUIRE(hoc_oc("vs = vr.c.sort()\n"
+                       "vi = vr.sortindex()\n"
+                       "vw = new Vector()\n"
+                       "vw.index(vr, vi)\n") == 0);
+        REQUIRE(hoc_value("vw.eq(vs)") == 1);
+        REQUIRE(hoc_value("vs.c.deriv(1, 1).min() >= 0") == 1);
+        // equal values keep their original order
+        REQUIRE(hoc_oc("vref.resize(0)\n"
+                       "for i = 1, vi.size - 1 if (vs.x[i] == vs.x[i-1] && vi.x[i] < vi.x[i-1]) "
+                       "vref.append(i)\n") == 0);
+        REQUIRE(hoc_value("vref.size") == 0);
+    }
+    SECTION("where and indvwhere match interpreted loops") {
+        for (auto const* cmp: {"\">\", 1", "\"<=\", 1", "\"==\", 0", "\"!=\", 0", "\"[)\", -1, 1"}) {
+            std::string const args{cmp};
+            std::string const test{args.substr(1, args.find('"', 1) - 1)};
+            REQUIRE(hoc_oc(("vw = vr.c.where(" + args + ")\n" + "vi = vr.c.indvwhere(" + args +
+                            ")\n")
+                               .c_str()) == 0);
+            std::string cond;
+            if (test == "[)") {
+                cond = "vr.x[i] >= -1 - float_epsilon && vr.x[i] < 1 - float_epsilon";
+            } else if (test == "==") {
+                cond = "abs(vr.x[i]) < float_epsilon";
+            } else if (test == "!=") {
+                cond = "abs(vr.x[i]) >= float_epsilon";
+            } else if (test == ">") {
+                cond = "vr.x[i] > 1 + float_epsilon";
+            } else {
+                cond = "vr.x[i] <= 1 + float_epsilon";
+            }
+            REQUIRE(hoc_oc(("vref.resize(0)\nvs = new Vector()\n"
+                            "for i = 0, vr.size - 1 if (" +
+                            cond + ") { vref.append(vr.x[i]) vs.append(i) }\n")
+                               .c_str()) == 0);
+            REQUIRE(hoc_value("vw.eq(vref)") == 1);
+            REQUIRE(hoc_value("vi.eq(vs)") == 1);
+        }
+        // source and destination may be the same Vector
+        REQUIRE(hoc_oc("vw = vr.c\nvw.where(vw, \">\", 1)\nvref = vr.c.where(\">\", 1)\n") == 0);
+        REQUIRE(hoc_value("vw.eq(vref)") == 1);
+    }
+    SECTION("histogram matches an interpreted loop") {
+        REQUIRE(hoc_oc("vw = vr.histogram(-2, 3, 0.5)\n"
+                       "vref = new Vector(vw.size)\n"
+                       "for i = 0, vr.size - 1 { j = int(floor((vr.x[i] + 2) / 0.5)) + 1 "
+                       "if (j >= 0 && j < vref.size) vref.x[j] += 1 }\n") == 0);
+        REQUIRE(hoc_value("vw.eq(vref)") == 1);
+    }
+    SECTION("spikebin matches an interpreted loop") {
+        REQUIRE(hoc_oc("vw = new Vector()\n"
+                       "vw.spikebin(vr, 1, 3)\n"
+                       "vref = new Vector(int(vr.size / 3))\n"
+                       "firing = 0\n"
+                       "for i = 0, 3 * vref.size - 1 {\n"
+                       "  if (vr.x[i] >= 1 && !firing) { firing = 1 vref.x[int(i / 3)] = 1 }\n"
+                       "  if (firing && vr.x[i] < 1) firing = 0\n"
+                       "}\n") == 0);
+        REQUIRE(hoc_value("vw.eq(vref)") == 1);
+    }
+    SECTION("apply of an arithmetic func matches an interpreted loop") {
+        REQUIRE(hoc_oc("a_apply = 2\n"
+                       "func f_apply() { return a_apply*sin($1)^2 + 1 - $1/3 }\n"
+                       "vw = vr.c.apply(\"f_apply\")\n"
+                       "vref = vr.c\n"
+                       "for i = 0, vr.size - 1 vref.x[i] = f_apply(vr.x[i])\n") == 0);
+        REQUIRE(hoc_value("vw.eq(vref)") == 1);
+    }
+    SECTION("timing on 10^7 samples") {
+        REQUIRE(hoc_oc("rn.uniform(-1, 1)\n"
+                       "vr = new Vector(1e7)\n"
+                       "vr.setrand(rn)\n") == 0);
+        std::cout << "[vector][times ms]" << std::endl;
+        for (auto const* stmt: {"vs = vr.c.sort()",
+                                "vi = vr.sortindex()",
+                                "vw = vr.c.where(\"[]\", -0.5, 0.5)",
+                                "vi = vr.c.indvwhere(\">\", 0)",
+                                "vw = vr.histogram(-1, 1, 0.01)",
+                                "vw.spikebin(vr, 0.5, 10)",
+                                "vw = vr.c.apply(\"f_apply\")",
+                                "vw = vr.c.apply(\"sin\")"}) {
+            std::cout << stmt << "\t" << time_ms(stmt) << std::endl;
+        }
+    }
+}
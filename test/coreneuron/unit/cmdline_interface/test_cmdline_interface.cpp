@@ -71,7 +71,9 @@ TEST_CASE("cmdline_interface") {
         "0.1",
 
         "--dt_io",
-        "0.2"};
+        "0.2",
+
+        "--binary-spikes"};
     constexpr int argc = sizeof argv / sizeof argv[0];
 
     corenrn_parameters corenrn_param_test;
@@ -97,6 +99,8 @@ TEST_CASE("cmdline_interface") {
 #endif
     REQUIRE(corenrn_param_test.dt_io == 0.2);
 
+    REQUIRE(corenrn_param_test.binary_spikes == true);
+
     REQUIRE(corenrn_param_test.forwardskip == 0.02);
 
     REQUIRE(corenrn_param_test.celsius == 25.12);
@@ -0,0 +1,99 @@
+/*
+# =============================================================================
+# Copyright (c) 2016 - 2022 Blue Brain Project/EPFL
+#
+# See top-level LICENSE file for details.
+# =============================================================================.
+*/
+#include "coreneuron/apps/corenrn_parameters.hpp"
+#include "coreneuron/io/output_spikes.hpp"
+#include "coreneuron/sim/multicore.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <utility>
+#include <vector>
+
+using namespace coreneuron;
+
+// spikes are recorded in arbitrary order, with -1 gids for artificial cells without gid
+static void fill_spikes(std::vector<std::pair<double, int>>& expected, int n = 50000) {
+    clear_spike_vectors();
+    for (int i = 0; i < n; ++i) {
+        double t = ((i * 7919) % 40000) * 0.025;
+        int gid = static_cast<int>((i * 104729LL) % 1000) - (i % 97 == 0 ? 1000 : 0);
+        spikevec_time.push_back(t);
+        spikevec_gid.push_back(gid);
+        if (gid > -1) {
+            expected.emplace_back(t, gid);
+        }
+    }
+    std::sort(expected.begin(), expected.end());
+}
+
+TEST_CASE("binary_spikes") {
+    std::vector<std::pair<double, int>> expected;
+    std::vector<double> spiketime;
+    std::vector<int> spikegid;
+
+    corenrn_param.binary_spikes = true;
+    fill_spikes(expected);
+    output_spikes(".", SpikesInfo{});
+    REQUIRE(spikevec_time.empty());
+    REQUIRE(read_spikes_binary("./out.bin", spiketime, spikegid));
+    REQUIRE(spiketime.size() == expected.size());
+    REQUIRE(spikegid.size() == expected.size());
+    for (std::size_t i = 0; i < expected.size(); ++i) {
+        REQUIRE(std::abs(spiketime[i] - expected[i].first) < 1e-6);
+        REQUIRE(spikegid[i] == expected[i].second);
+    }
+
+    // the text file holds the same spikes in the same order
+    corenrn_param.binary_spikes = false;
+    expected.clear();
+    fill_spikes(expected);
+    output_spikes(".", SpikesInfo{});
+    FILE* f = fopen("./out.dat", "r");
+    REQUIRE(f);
+    double t;
+    int gid;
+    std::size_t n = 0;
+    while (fscanf(f, "%lf %d", &t, &gid) == 2) {
+        REQUIRE(n < expected.size());
+        REQUIRE(std::abs(t - expected[n].first) < 1e-5);
+        REQUIRE(gid == expected[n].second);
+        ++n;
+    }
+    fclose(f);
+    REQUIRE(n == expected.size());
+
+    // not a spike file
+    REQUIRE_FALSE(read_spikes_binary("./out.dat", spiketime, spikegid));
+    REQUIRE_FALSE(read_spikes_binary("./no_such_file.bin", spiketime, spikegid));
+}
+
+TEST_CASE("binary_spikes_threads") {
+    // with several threads the spikes are sorted in runs that are then merged. 5 threads and
+    // 200000 spikes give 5 runs of more than the minimum length, an odd number to merge
+    const int nthread = nrn_nthread;
+    nrn_nthread = 5;
+    std::vector<std::pair<double, int>> expected;
+    std::vector<double> spiketime;
+    std::vector<int> spikegid;
+
+    corenrn_param.binary_spikes = true;
+    fill_spikes(expected, 200000);
+    output_spikes(".", SpikesInfo{});
+    nrn_nthread = nthread;
+    REQUIRE(read_spikes_binary("./out.bin", spiketime, spikegid));
+    REQUIRE(spiketime.size() == expected.size());
+    REQUIRE(spikegid.size() == expected.size());
+    for (std::size_t i = 0; i < expected.size(); ++i) {
+        REQUIRE(std::abs(spiketime[i] - expected[i].first) < 1e-6);
+        REQUIRE(spikegid[i] == expected[i].second);
+    }
+    corenrn_param.binary_spikes = false;
+}
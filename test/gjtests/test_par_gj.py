@@ -133,6 +133,12 @@ def main():
         action="store_true",
         help="use sparse parallel transfer",
     )
+    parser.add_argument(
+        "--lag",
+        default=False,
+        action="store_true",
+        help="lag the transfer between ranks by one time step, pc.setup_transfer(1)",
+    )
     parser.add_argument(
         "--result-prefix",
         default=".",
@@ -150,7 +156,7 @@ def main():
     mkcells(pc, args.ngids)
     mkgjs(pc, args.ngids)
 
-    pc.setup_transfer()
+    pc.setup_transfer(1 if args.lag else 0)
 
     if args.sparse_partrans:
         if hasattr(h, "nrn_sparse_partrans"):
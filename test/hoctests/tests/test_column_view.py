@@ -0,0 +1,69 @@
+import numpy as np
+import pytest
+
+from neuron import h, nrn
+
+
+def model():
+    secs = [h.Section(name="c%d" % i) for i in range(3)]
+    for i, sec in enumerate(secs):
+        sec.nseg = i + 2
+        sec.insert("hh")
+        if i:
+            sec.connect(secs[0](1))
+    return secs
+
+
+def test_column_view():
+    secs = model()
+    h.finitialize(-65)
+
+    col = nrn.column("m_hh")
+    assert col.valid()
+    m = np.asarray(col)
+    segs = col.segments()
+    assert len(segs) == len(m) == sum(sec.nseg for sec in secs)
+    for seg, val in zip(segs, m):
+        assert seg.hh.m == val
+    with pytest.raises(ValueError):
+        m[0] = 0.5
+
+    # writable views write through to the model
+    gna = np.asarray(nrn.column("gnabar_hh", True))
+    gna[:] = np.arange(len(gna)) * 0.01
+    for seg, val in zip(nrn.column("gnabar_hh").segments(), gna):
+        assert seg.hh.gnabar == val
+
+    # voltage is indexed by node, including the section ends
+    vcol = nrn.column("v")
+    v = np.asarray(vcol)
+    vsegs = vcol.segments()
+    assert all(seg is not None for seg in vsegs)
+    for seg, val in zip(vsegs, v):
+        assert seg.v == val
+
+    # a structure change invalidates the views
+    mold = m.copy()
+    secs[1].insert("pas")
+    secs[1].nseg = 5
+    secs.append(h.Section(name="c3"))
+    secs[3].insert("hh")
+    h.finitialize(-65)
+    assert not col.valid()
+    # but earlier ndarrays still hold the old values instead of dangling
+    assert np.array_equal(m, mold)
+    assert not vcol.valid()
+    with pytest.raises(RuntimeError):
+        np.asarray(col)
+    with pytest.raises(RuntimeError):
+        col.segments()
+    assert nrn.column("m_hh").valid()
+
+    with pytest.raises(ValueError):
+        nrn.column("nosuchvar")
+    with pytest.raises(ValueError):
+        nrn.column("i_membrane_")
+
+
+if __name__ == "__main__":
+    test_column_view()
@@ -0,0 +1,60 @@
+from neuron import h
+from neuron.expect_hocerr import expect_err
+
+# Exercise the fused hoc instructions (variable push/eval, variable
+# assignment, constant arithmetic) and their fallbacks.
+h(
+    """
+double fused_a[3]
+fused_x = 1
+fused_y = 0
+begintemplate FusedT
+  public y, f
+  proc init() { y = 2 }
+  func f() { local z
+    z = $1
+    z = z * 2 + 1
+    y += z - 3
+    return y / 2
+  }
+endtemplate FusedT
+func fused_sum() { local i, s
+  s = 0
+  for i = 0, $1 - 1 { s = s + i * 2 - 1 }
+  return s
+}
+func fused_div() { return $1 / 0 }
+"""
+)
+
+
+def test_fused():
+    h("fused_x = fused_x + 1")
+    assert h.fused_x == 2
+    h("fused_x = fused_x - 0.5")
+    assert h.fused_x == 1.5
+    h("fused_x *= 4")
+    assert h.fused_x == 6
+    h("fused_x = fused_x / 3")
+    assert h.fused_x == 2
+    # arrays and USERINT/USERDOUBLE builtins take the general path
+    h("fused_a[1] = fused_x * 3  fused_a[2] = fused_a[1] + fused_a[1] - 1")
+    assert list(h.fused_a) == [0, 6, 11]
+    h("fused_y = dt * 2")
+    assert h.fused_y == h.dt * 2
+    h("secondorder = 2  fused_x = secondorder + 1  secondorder = 0")
+    assert h.fused_x == 3
+    assert h.fused_sum(10) == sum(2 * i - 1 for i in range(10))
+    # object data and locals
+    o = h.FusedT()
+    assert o.f(3) == 3
+    assert o.y == 6
+    # constant divisor of zero is still caught
+    expect_err("h.fused_div(1)")
+    # left operand on the stack, constant subtracted/divided on the right
+    h("fused_x = 10 - 4 / 2")
+    assert h.fused_x == 8
+
+
+if __name__ == "__main__":
+    test_fused()
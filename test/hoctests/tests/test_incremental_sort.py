@@ -0,0 +1,77 @@
+from neuron import h
+
+h.load_file("stdrun.hoc")
+
+
+def run(secs):
+    vvecs = [h.Vector().record(sec(0.5)._ref_v) for sec in secs]
+    h.finitialize(-65)
+    h.continuerun(3)
+    return vvecs
+
+
+def test_incremental_sort():
+    pc = h.ParallelContext()
+    stats = h.Vector()
+    secs = [h.Section(name="s%d" % i) for i in range(4)]
+    for i, sec in enumerate(secs):
+        sec.nseg = 3
+        sec.insert("hh")
+        sec.insert("pas")
+        if i:
+            sec.connect(secs[0](1))
+    run(secs)
+
+    # a new point process only changes the IClamp data
+    stim = h.IClamp(secs[2](0.5))
+    stim.delay = 0.5
+    stim.dur = 1
+    stim.amp = 0.5
+    incremental = run(secs)
+    pc.sort_stats(stats)
+    assert stats[0] == 0
+    assert stats[1] >= 1
+    assert stats[2] > 0
+    assert pc.sort_stats() == stats[3]
+
+    # new Nodes force a full rebuild, with the same results
+    extra = h.Section(name="extra")
+    full = run(secs)
+    pc.sort_stats(stats)
+    assert stats[0] == 1
+    assert stats[2] == 0
+    for a, b in zip(incremental, full):
+        assert a.eq(b)
+
+    # new hh and ion instances, the cached ion pointers of hh are rebuilt
+    generation = stats[4]
+    extra.insert("hh")
+    again = run(secs)
+    pc.sort_stats(stats)
+    assert stats[0] == 0
+    assert stats[4] > generation
+    for a, b in zip(incremental, again):
+        assert a.eq(b)
+
+    # moving a point process to another Node must not reuse its stale cache
+    stim2 = h.IClamp(secs[1](0.5))
+    stim2.delay = 0.2
+    stim2.dur = 1
+    stim2.amp = 0.3
+    run(secs)
+    stim.loc(secs[3](0.2))
+    ivecs = [h.Vector().record(s._ref_i) for s in (stim, stim2)]
+    moved = run(secs)
+    moved_i = [v.c() for v in ivecs]
+    pc.sort_stats(stats)
+    assert stats[0] == 0
+    h.Section(name="extra2")
+    full = run(secs)
+    pc.sort_stats(stats)
+    assert stats[0] == 1
+    for a, b in zip(moved + moved_i, full + ivecs):
+        assert a.eq(b)
+
+
+if __name__ == "__main__":
+    test_incremental_sort()
@@ -0,0 +1,95 @@
+from neuron import h
+
+h.load_file("stdrun.hoc")
+h.load_file("loadbal.hoc")
+pc = h.ParallelContext()
+
+h(
+    """
+begintemplate LBCell
+public soma, dend, all
+create soma, dend[1]
+objref all
+proc init() {local i
+	create dend[$1]
+	all = new SectionList()
+	soma all.append()
+	forall nseg = 1
+	soma insert hh
+	for i=0, $1-1 {
+		connect dend[i](0), soma(1)
+		dend[i] { nseg = 5  insert pas  all.append() }
+	}
+}
+endtemplate LBCell
+"""
+)
+
+
+def make_cells(ndend):
+    cells = {}
+    for gid, n in enumerate(ndend):
+        if gid % pc.nhost() != pc.id():
+            continue
+        cell = h.LBCell(n)
+        pc.set_gid2node(gid, pc.id())
+        pc.cell(gid, h.NetCon(cell.soma(0.5)._ref_v, None, sec=cell.soma))
+        cells[gid] = cell
+    return cells
+
+
+def test_gid_balance():
+    ndend = [1, 8, 2, 2, 5, 1, 3, 4]
+    cells = make_cells(ndend)
+    lb = h.LoadBalance()
+    gids = h.Vector(sorted(cells))
+    cx = lb.gid_complexity(gids)
+    # more dendrites, more complexity
+    for i in range(1, len(gids)):
+        a, b = int(gids[i - 1]), int(gids[i])
+        assert (cx[i - 1] < cx[i]) == (ndend[a] < ndend[b])
+
+    # measured complexities keep the total of the model
+    total = lb.cpu_complexity()
+    lb.measure_mcomplex(5)
+    assert abs(lb.cpu_complexity() - total) < 1e-9 * total
+    # and the mechanism timing is off again afterwards
+    mt = h.MechanismType(0)
+    mt.select("hh")
+    assert pc.mech_time(mt.internal_type()) == 0
+
+    cx = lb.gid_complexity(gids)
+    mine = lb.gid_balance(gids, cx, 1)
+
+    # every rank sees the gids and complexities of all, in rank order
+    def gather(vec):
+        result = h.Vector()
+        for r in range(pc.nhost()):
+            v = h.Vector(vec) if r == pc.id() else h.Vector()
+            pc.broadcast(v, r)
+            result.append(v)
+        return result
+
+    allgids, allcx = gather(gids), gather(cx)
+    assert sorted(allgids) == list(range(len(ndend)))
+    part = lb.lpt(allcx, pc.nhost(), 0)
+    assert list(mine) == [g for g, r in zip(allgids, part) if r == pc.id()]
+    assert sorted(gather(mine)) == list(range(len(ndend)))
+    assert lb.rank_cxbal_ >= 1 and lb.rank_cxbal0_ >= 1
+    pc.gid_clear()
+
+
+def test_lpt():
+    lb = h.LoadBalance()
+    w = h.Vector([2, 7, 4, 5, 1, 3])
+    # the heaviest piece goes on the lightest partition, the first on a tie
+    assert list(lb.lpt(w, 2, 0)) == [1, 0, 1, 1, 0, 0]
+    assert lb.thread_cxbal_ == 1
+    assert list(lb.lpt(w, 3, 0)) == [1, 0, 2, 1, 0, 2]
+    assert abs(lb.thread_cxbal_ - 8 / (22 / 3)) < 1e-12
+    assert list(lb.lpt(w, 1, 0)) == [0] * 6
+
+
+if __name__ == "__main__":
+    test_gid_balance()
+    test_lpt()
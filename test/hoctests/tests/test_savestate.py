@@ -0,0 +1,66 @@
+from neuron import h
+from neuron.expect_hocerr import expect_err
+
+h.load_file("stdrun.hoc")
+
+
+def model():
+    secs = [h.Section(name="s%d" % i) for i in range(3)]
+    for i, sec in enumerate(secs):
+        sec.nseg = 5
+        sec.L = 100
+        sec.insert("hh")
+        if i:
+            sec.connect(secs[0](1))
+    stim = h.IClamp(secs[0](0.5))
+    stim.delay = 0.1
+    stim.dur = 0.5
+    stim.amp = 0.5
+    return secs, stim
+
+
+def states(secs):
+    return [(seg.v, seg.hh.m, seg.hh.h, seg.hh.n) for sec in secs for seg in sec]
+
+
+def test_savestate_restore():
+    secs, stim = model()
+    h.finitialize(-65)
+    h.continuerun(1)
+    ss = h.SaveState()
+    ss.save()
+    saved = states(secs)
+    tsaved = h.t
+
+    # restore without structural change (column copy)
+    h.continuerun(3)
+    assert states(secs) != saved
+    ss.restore()
+    assert h.t == tsaved
+    assert states(secs) == saved
+
+    # parameters are not part of the state and must survive a restore
+    secs[1](0.5).hh.gnabar = 0.2
+    h.continuerun(3)
+    ss.restore()
+    assert states(secs) == saved
+    assert secs[1](0.5).hh.gnabar == 0.2
+    secs[1](0.5).hh.gnabar = 0.12
+
+    # data permuted by a thread change, restore walks the sections
+    pc = h.ParallelContext()
+    pc.nthread(2)
+    h.finitialize(-65)
+    h.continuerun(3)
+    ss.restore()
+    assert states(secs) == saved
+    pc.nthread(1)
+
+    # a structure change is still detected (pas has no states, so it
+    # would not count as one)
+    secs[2].nseg = 3
+    expect_err("ss.restore()")
+
+
+if __name__ == "__main__":
+    test_savestate_restore()
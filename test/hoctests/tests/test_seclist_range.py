@@ -0,0 +1,61 @@
+from neuron import h
+from neuron.expect_hocerr import expect_err
+
+
+def model():
+    secs = [h.Section(name="r%d" % i) for i in range(3)]
+    for i, sec in enumerate(secs):
+        sec.nseg = 2 * i + 1
+        sec.insert("hh")
+        sec.insert("pas")
+        if i:
+            sec.connect(secs[0](1))
+    sl = h.SectionList()
+    sl.wholetree(sec=secs[0])
+    return secs, sl
+
+
+def segvals(sl, name):
+    return [getattr(seg, name) for sec in sl for seg in sec]
+
+
+def test_getrange_setrange():
+    secs, sl = model()
+    nseg = sum(sec.nseg for sec in secs)
+    h.finitialize(-65)
+
+    for name in ["v", "diam", "gnabar_hh", "m_hh", "g_pas"]:
+        vec = sl.getrange(name)
+        assert vec.size() == nseg
+        assert list(vec) == segvals(sl, name)
+
+    vals = h.Vector(nseg).indgen().mul(0.001)
+    assert sl.setrange("gnabar_hh", vals) == nseg
+    assert segvals(sl, "gnabar_hh") == list(vals)
+    # reuse the caller's Vector
+    vec = h.Vector()
+    assert sl.getrange("gnabar_hh", vec) is vec
+    assert vec.eq(vals)
+
+    sl.setrange("v", -50)
+    assert segvals(sl, "v") == [-50] * nseg
+
+    # diam changes update the geometry
+    area = secs[1](0.5).area()
+    sl.setrange("diam", 2 * secs[1](0.5).diam)
+    assert abs(secs[1](0.5).area() - 2 * area) < 1e-9 * area
+
+    # sections deleted from the list are skipped
+    del secs[2]
+    assert sl.getrange("v").size() == nseg - 5
+
+    expect_err('sl.getrange("nosuchvar")')
+    expect_err('sl.setrange("g_pas", h.Vector(2))')
+    expect_err('sl.setrange("i_membrane_", 0)')
+    extra = h.Section(name="extra")
+    sl.append(extra)
+    expect_err('sl.getrange("gnabar_hh")')
+
+
+if __name__ == "__main__":
+    test_getrange_setrange()
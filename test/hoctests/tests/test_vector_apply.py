@@ -0,0 +1,60 @@
+import math
+
+from neuron import h
+from neuron.expect_hocerr import expect_err
+
+h(
+    """
+a_apply = 2
+func f_apply() { return a_apply*sin($1)^2 + 1 - $1/3 }
+func g_apply() { return -(($1 + 1) * 2.5 - 4) / 8 }
+func inv_apply() { return 1/$1 }
+func loc_apply() { local y  y = $1*$1  return y + 1 }
+func if_apply() { if ($1 > 0) { return $1 } return 0 }
+begintemplate ApplyTest
+public a, f, run
+a = 0
+proc init() { a = $1 }
+func f() { return a*$1 }
+proc run() { $o1.apply("f") }
+endtemplate ApplyTest
+"""
+)
+
+
+def check(name, values):
+    v = h.Vector(values)
+    expect = [getattr(h, name)(x) for x in values]
+    assert list(v.apply(name)) == expect
+    # the index range form
+    w = h.Vector(values)
+    w.apply(name, 1, len(values) - 2)
+    assert list(w) == [values[0]] + expect[1:-1] + [values[-1]]
+
+
+def test_apply():
+    values = [0.1 * i - 3 for i in range(61)]
+    for name in ["f_apply", "g_apply", "loc_apply", "if_apply", "sin", "exp"]:
+        check(name, values)
+    # variables are read when apply runs
+    h.a_apply = 5
+    check("f_apply", values)
+
+    # errors leave the elements before the failing one updated
+    v = h.Vector([1, 2, 0, 4])
+    expect_err('v.apply("inv_apply")')
+    assert list(v) == [1, 0.5, 0, 4]
+    expect_err('h.Vector([-1]).apply("sqrt")')
+
+    # template funcs see their own object's variables
+    ob = h.ApplyTest(3)
+    v = h.Vector(values)
+    ob.run(v)
+    assert list(v) == [3 * x for x in values]
+
+    # python callables are unchanged
+    assert list(h.Vector(values).apply(math.cos)) == [math.cos(x) for x in values]
+
+
+if __name__ == "__main__":
+    test_apply()
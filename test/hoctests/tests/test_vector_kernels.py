@@ -0,0 +1,69 @@
+import numpy as np
+
+from neuron import h
+from neuron.expect_hocerr import expect_err
+
+
+def data(n):
+    # ties, -0, values on the comparison bounds, large enough for radix sort
+    rng = np.random.default_rng(1)
+    x = rng.integers(-20, 20, n) * 0.25
+    x[7] = -0.0
+    return x
+
+
+def test_sort_sortindex():
+    for n in [100, 20000]:
+        x = data(n)
+        v = h.Vector(x)
+        assert np.array_equal(np.array(v.c().sort()), np.sort(x))
+        assert np.array_equal(np.array(v.sortindex()), np.argsort(x, kind="stable"))
+
+
+def test_where():
+    x = data(20000)
+    v = h.Vector(x)
+    e = h.float_epsilon
+    cases = {
+        (">", 1): x > 1 + e,
+        ("<", 1): x < 1 - e,
+        (">=", 1): x >= 1 - e,
+        ("<=", 1): x <= 1 + e,
+        ("==", 0): (x - 0 < e) & (0 - x < e),
+        ("!=", 0): ~((x - 0 < e) & (0 - x < e)),
+        ("()", -1, 1): (x > -1 + e) & (x < 1 - e),
+        ("[]", -1, 1): (x >= -1 - e) & (x <= 1 + e),
+        ("[)", -1, 1): (x >= -1 - e) & (x < 1 - e),
+        ("(]", -1, 1): (x > -1 + e) & (x <= 1 + e),
+    }
+    for args, mask in cases.items():
+        assert np.array_equal(np.array(v.c().where(*args)), x[mask])
+        assert np.array_equal(np.array(h.Vector().where(v, *args)), x[mask])
+        assert np.array_equal(np.array(v.c().indvwhere(*args)), np.flatnonzero(mask))
+        first = v.indwhere(*args)
+        assert first == (np.flatnonzero(mask)[0] if mask.any() else -1)
+    # source and destination the same Vector
+    w = v.c()
+    w.where(w, ">", 1)
+    assert np.array_equal(np.array(w), x[x > 1 + e])
+    expect_err('v.where("=>", 1)')
+
+
+def test_histogram_spikebin():
+    x = data(20000)
+    v = h.Vector(x)
+    hist = np.array(v.histogram(-2, 3, 0.5))
+    ind = np.floor((x + 2) / 0.5).astype(int) + 1
+    ind = ind[(ind >= 0) & (ind < len(hist))]
+    assert np.array_equal(hist, np.bincount(ind, minlength=len(hist)))
+
+    bins = np.array(h.Vector().spikebin(v, 1, 3))
+    above = x[: 3 * len(bins)] >= 1
+    up = above & ~np.concatenate(([False], above[:-1]))
+    assert np.array_equal(bins, up.reshape(-1, 3).any(axis=1))
+
+
+if __name__ == "__main__":
+    test_sort_sortindex()
+    test_where()
+    test_histogram_spikebin()
@@ -0,0 +1,88 @@
+from neuron import h
+
+h.load_file("stdrun.hoc")
+
+
+def test_record_after_resort():
+    # Recording must follow the data when the model is re-sorted mid run.
+    secs = [h.Section(name="s%d" % i) for i in range(4)]
+    for sec in secs:
+        sec.insert("hh")
+    stim = h.IClamp(secs[0](0.5))
+    stim.delay = 0.5
+    stim.dur = 0.5
+    stim.amp = 0.5
+    tvec = h.Vector().record(h._ref_t)
+    vvecs = [h.Vector().record(sec(0.5)._ref_v) for sec in secs]
+    mvecs = [h.Vector().record(sec(0.5).hh._ref_m) for sec in secs]
+
+    h.finitialize(-65)
+    vals = []
+    for i in range(40):
+        if i == 20:
+            # new mechanism instances permute and reallocate the model data
+            for sec in secs[1:]:
+                sec.insert("pas")
+                sec.g_pas = 0
+        vals.append((h.t, [sec(0.5).v for sec in secs], [sec(0.5).hh.m for sec in secs]))
+        h.fadvance()
+    vals.append((h.t, [sec(0.5).v for sec in secs], [sec(0.5).hh.m for sec in secs]))
+
+    assert tvec.size() == len(vals)
+    for i, (t, v, m) in enumerate(vals):
+        assert tvec[i] == t
+        assert [vv[i] for vv in vvecs] == v
+        assert [mv[i] for mv in mvecs] == m
+
+
+def test_record_threads_cvode():
+    pc = h.ParallelContext()
+    secs = [h.Section(name="c%d" % i) for i in range(4)]
+    for sec in secs:
+        sec.insert("hh")
+    stims = [h.IClamp(sec(0.5)) for sec in secs]
+    for i, stim in enumerate(stims):
+        stim.delay = 0.2 * i
+        stim.dur = 0.5
+        stim.amp = 0.5
+    results = []
+    for nthread, use_cvode in [(1, False), (2, False), (1, True), (2, True)]:
+        pc.nthread(nthread)
+        h.cvode_active(use_cvode)
+        tvec = h.Vector().record(h._ref_t)
+        vvecs = [h.Vector().record(sec(0.5)._ref_v) for sec in secs]
+        h.finitialize(-65)
+        h.continuerun(2)
+        results.append((tvec, vvecs))
+        assert all(v.size() == tvec.size() for v in vvecs)
+    # same trajectories for the same method, whatever the thread count
+    for a, b in [(0, 1), (2, 3)]:
+        assert results[a][0].eq(results[b][0])
+        for va, vb in zip(results[a][1], results[b][1]):
+            assert va.eq(vb)
+    h.cvode_active(False)
+    pc.nthread(1)
+
+
+def test_record_vector_deleted():
+    # Deleting a recorded Vector mid run must drop it from the batch.
+    secs = [h.Section(name="d%d" % i) for i in range(3)]
+    for sec in secs:
+        sec.insert("hh")
+    tvec = h.Vector().record(h._ref_t)
+    vvecs = [h.Vector().record(sec(0.5)._ref_v) for sec in secs]
+    t2 = h.Vector().record(h._ref_t)
+    h.finitialize(-65)
+    h.fadvance()
+    del vvecs[1], t2
+    h.fadvance()
+    h.fadvance()
+    assert tvec.size() == 4
+    assert all(v.size() == 4 for v in vvecs)
+    assert vvecs[1][3] == secs[2](0.5).v
+
+
+if __name__ == "__main__":
+    test_record_after_resort()
+    test_record_threads_cvode()
+    test_record_vector_deleted()
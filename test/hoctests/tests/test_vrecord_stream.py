@@ -0,0 +1,93 @@
+import os
+import tempfile
+
+from neuron import h
+from neuron.expect_hocerr import expect_err
+
+h.load_file("stdrun.hoc")
+
+
+def test_record_stream():
+    soma = h.Section(name="soma")
+    soma.insert("hh")
+    stim = h.IClamp(soma(0.5))
+    stim.delay = 1
+    stim.dur = 1
+    stim.amp = 0.3
+
+    # small chunks so that each trace is handed to the writer several times
+    chunk = h.cvode.record_chunk()
+    assert h.cvode.record_chunk(64) == 64
+
+    with tempfile.TemporaryDirectory() as tmpdir:
+        vstep = h.Vector().record(soma(0.5)._ref_v)
+        vdt = h.Vector().record(soma(0.5)._ref_v, 0.1)
+        sstep = h.Vector().record(soma(0.5)._ref_v, os.path.join(tmpdir, "step.dat"))
+        sdt = h.Vector().record(soma(0.5)._ref_v, 0.1, os.path.join(tmpdir, "dt.dat"))
+        # two traces sharing one file
+        shared = os.path.join(tmpdir, "shared.dat")
+        sh1 = h.Vector().record(soma(0.5)._ref_v, shared)
+        sh2 = h.Vector().record(soma(0.5)._ref_v, 0.1, shared)
+
+        h.finitialize(-65)
+        h.continuerun(5)
+        # nothing accumulates in the Vector during the run
+        assert sstep.size() == 0
+        assert vstep.size() > 3 * 64
+
+        sstep.record_load()
+        sdt.record_load()
+        assert sstep.eq(vstep)
+        assert sdt.eq(vdt)
+        assert os.path.getsize(os.path.join(tmpdir, "step.dat")) == 8 * vstep.size()
+        sh1.record_load()
+        sh2.record_load()
+        assert sh1.eq(vstep)
+        assert sh2.eq(vdt)
+        assert os.path.getsize(shared) == 8 * (vstep.size() + vdt.size())
+
+        # a window across chunks, clipped at the end of the recording
+        sstep.record_load(60, 10)
+        assert sstep.eq(vstep.c(60, 69))
+        sh1.record_load(60, 10)
+        assert sh1.eq(vstep.c(60, 69))
+        sstep.record_load(vstep.size() - 2, 100)
+        assert sstep.size() == 2
+
+        # finitialize starts over, SaveState restore truncates
+        h.finitialize(-65)
+        h.continuerun(2)
+        ss = h.SaveState()
+        ss.save()
+        n = round(h.t / h.dt) + 1
+        h.continuerun(5)
+        ss.restore()
+        sstep.record_load()
+        assert sstep.size() == n
+        assert sstep.eq(vstep.c(0, n - 1))
+        sh1.record_load()
+        assert sh1.eq(vstep.c(0, n - 1))
+        h.continuerun(5)
+        sh1.record_load()
+        assert sh1.eq(vstep)
+
+        # changing the chunk size mid run keeps the values
+        h.finitialize(-65)
+        h.continuerun(2)
+        h.cvode.record_chunk(100)
+        h.continuerun(5)
+        sstep.record_load()
+        sh2.record_load()
+        assert sstep.eq(vstep)
+        assert sh2.eq(vdt)
+
+        expect_err("h.Vector().record_load()")
+        expect_err('h.Vector().record(soma(0.5)._ref_v, h.Vector([1, 2]), "x.dat")')
+
+        # close the files before the directory goes
+        del sstep, sdt, sh1, sh2
+    h.cvode.record_chunk(chunk)
+
+
+if __name__ == "__main__":
+    test_record_stream()
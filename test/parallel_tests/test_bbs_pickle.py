@@ -0,0 +1,71 @@
+# Bulletin board messages carrying protocol 5 pickles with out of band
+# buffers, packed and unpacked in parts, with sizes on both sides of the
+# largest buffer kept for reuse.
+# mpiexec -n 2 nrniv -mpi -python test/parallel_tests/test_bbs_pickle.py
+import pickle
+
+from neuron import h
+
+pc = h.ParallelContext()
+
+
+class Blob:
+    """Pickled with its data as an out of band buffer."""
+
+    def __init__(self, data):
+        self.data = bytearray(data)
+
+    def __reduce_ex__(self, protocol):
+        if protocol >= 5:
+            return Blob, (pickle.PickleBuffer(self.data),)
+        return Blob, (bytes(self.data),)
+
+
+def pattern(n, i):
+    s = bytes(range(256)) * (n // 256 + 2)
+    return s[i % 256 : i % 256 + n]
+
+
+def task(i, blob):
+    assert blob.data == pattern(len(blob.data), i)
+    # an argument unpacked again through ParallelContext.upkpyobj
+    pc.pack(blob, Blob(blob.data[::-1]))
+    pc.post("blob%d" % i)
+    return i, pc.id(), Blob(blob.data[::-1])
+
+
+# the pack buffer pool keeps buffers of up to 1 MB
+sizes = [0, 1, 100, 70000, (1 << 20) - 1000, (1 << 20) + 3, 3 << 20]
+
+
+def test_bbs_pickle():
+    if pc.nhost() > 1:
+        pc.master_works_on_jobs(0)
+    ids = {}
+    for rep in range(3):
+        for n in sizes:
+            i = len(ids)
+            ids[i] = n
+            pc.submit(task, i, Blob(pattern(n, i)))
+    ranks = set()
+    while pc.working():
+        i, rank, blob = pc.pyret()
+        ranks.add(rank)
+        n = ids.pop(i)
+        assert blob.data == pattern(n, i)[::-1]
+        pc.take("blob%d" % i)
+        a = pc.upkpyobj()
+        b = pc.upkpyobj()
+        assert a.data == pattern(n, i)
+        assert b.data == pattern(n, i)[::-1]
+    assert not ids
+    if pc.nhost() > 1:
+        assert ranks != {0}
+        pc.master_works_on_jobs(1)
+
+
+if __name__ == "__main__":
+    pc.runworker()
+    test_bbs_pickle()
+    pc.done()
+    h.quit()
@@ -0,0 +1,59 @@
+import struct
+
+import pytest
+
+from neuron import coreneuron
+
+
+def varint(x):
+    out = bytearray()
+    while True:
+        out.append((x & 0x7F) | (0x80 if x > 0x7F else 0))
+        x >>= 7
+        if not x:
+            return bytes(out)
+
+
+def block(spikes, tick):
+    """One rank's block of an out.bin for (time, gid) pairs sorted by time."""
+    payload = bytearray()
+    previous = None
+    for t, gid in spikes:
+        ticks = round(t / tick)
+        if previous is None:
+            payload += varint((ticks << 1) ^ (ticks >> 63))  # zigzag
+        else:
+            payload += varint(ticks - previous)
+        payload += varint(gid)
+        previous = ticks
+    header = struct.pack("=8sdQQ", b"CNSPIKE1", tick, len(spikes), len(payload))
+    return header + bytes(payload)
+
+
+def test_read_spikes(tmp_path):
+    tick = 2.0**-24
+    # two ranks, each sorted, with multi byte varints for both times and gids
+    rank0 = [(0.0, 3), (0.025, 200), (0.025, 70000), (1.5, 1)]
+    rank1 = [(1.5, 2), (100.0, 5), (2000.125, 2**31 - 1)]
+    path = tmp_path / "out.bin"
+    path.write_bytes(block(rank0, tick) + block(rank1, tick) + block([], tick))
+    times, gids = coreneuron.read_spikes(str(path))
+    assert gids == [gid for _, gid in rank0 + rank1]
+    assert all(abs(a - t) <= tick for a, (t, _) in zip(times, rank0 + rank1))
+    assert len(times) == len(rank0) + len(rank1)
+
+    # the smallest block, by hand: t = 1 tick, gid 5
+    path.write_bytes(struct.pack("=8sdQQ", b"CNSPIKE1", tick, 1, 2) + b"\x02\x05")
+    assert coreneuron.read_spikes(str(path)) == ([tick], [5])
+
+    # a text spike file is refused
+    path.write_bytes(b"0.025 1\n1.5 2\n" * 4)
+    with pytest.raises(ValueError):
+        coreneuron.read_spikes(str(path))
+
+
+if __name__ == "__main__":
+    import pathlib, tempfile
+
+    with tempfile.TemporaryDirectory() as d:
+        test_read_spikes(pathlib.Path(d))
@@ -0,0 +1,60 @@
+# ParallelContext.multisplit tests.
+# Cells split into pieces spread over the ranks give the same voltages as
+# the same cells whole on one rank.
+
+from neuron import h
+
+pc = h.ParallelContext()
+rank = int(pc.id())
+nhost = int(pc.nhost())
+
+
+class Cable:
+    """Four sections in a row. If split, piece k is section k and the
+    sections are only joined by multisplit sids."""
+
+    def __init__(self, i, split):
+        self.secs = {}
+        for k in range(4):
+            host = (i + k) % nhost if split else i % nhost
+            if host != rank:
+                continue
+            sec = h.Section(name=f"cable{i}_{k}_{split}")
+            sec.L, sec.diam, sec.nseg = 200, 1 + k, 5
+            sec.insert("hh" if k == 0 else "pas")
+            self.secs[k] = sec
+        for k in range(3):
+            if split:
+                if k in self.secs:
+                    pc.multisplit(self.secs[k](1), 10 * i + k)
+                if k + 1 in self.secs:
+                    pc.multisplit(self.secs[k + 1](0), 10 * i + k)
+            elif self.secs:
+                self.secs[k + 1].connect(self.secs[k](1))
+        if 0 in self.secs:
+            self.stim = h.IClamp(self.secs[0](0.5))
+            self.stim.delay, self.stim.dur, self.stim.amp = 1, 3, 0.1 + 0.05 * i
+            self.v = h.Vector().record(self.secs[0](0.5)._ref_v)
+
+
+def test_multisplit():
+    """Each cable has two backbones so every cell makes a ReducedTree and
+    each rank has several, which the threads share."""
+
+    pc.nthread(2)
+    whole = [Cable(i, False) for i in range(4)]
+    split = [Cable(i, True) for i in range(4)]
+    pc.multisplit()
+    pc.set_maxstep(10)
+    h.finitialize(-65)
+    pc.psolve(10)
+    pc.barrier()
+    for a, b in zip(whole, split):
+        if hasattr(a, "v"):
+            assert a.v.c().sub(b.v).abs().max() < 1e-6
+
+
+if __name__ == "__main__":
+    test_multisplit()
+    pc.barrier()
+    h.quit()
@@ -398,7 +398,55 @@ def test_partrans():
     teardown()
 
 
+def test_partrans_lag():
+    """
+    setup_transfer(1) lags the transfer between ranks by one fixed step.
+    Initialization is exact and the voltages stay close to those with the
+    complete transfer, identical with a single rank.
+    """
+    ncell = 6
+    mkmodel(ncell)
+    mkgaps(list(range(ncell)))  # ring
+    for cell in model[0].values():
+        for gap in cell.hgap:
+            gap.gmax = 0.001
+    if pc.gid_exists(0):
+        ic = model[0][0].ic
+        ic.delay, ic.dur, ic.amp = 0.5, 2, 0.1
+
+    def simulate(lag):
+        pc.setup_transfer(lag)
+        vecs = {
+            gid: h.Vector().record(c.soma(0.5)._ref_v) for gid, c in model[0].items()
+        }
+        h.finitialize(-65)
+        while h.t < 5:
+            h.fadvance()
+        # stop recording so the next run does not overwrite the results
+        for vec in vecs.values():
+            vec.play_remove()
+        return {gid: vec.c() for gid, vec in vecs.items()}
+
+    exact = simulate(0)
+    lagged = simulate(1)
+    maxdiff = 0.0
+    for gid in exact:
+        assert exact[gid].size() == lagged[gid].size()
+        assert exact[gid][0] == lagged[gid][0]
+        diff = exact[gid].c().sub(lagged[gid]).abs().max()
+        maxdiff = max(maxdiff, diff)
+        assert diff < 1e-2 * (exact[gid].max() - exact[gid].min() + 1e-9)
+    maxdiff = pc.allreduce(maxdiff, 2)
+    if nhost == 1:
+        assert maxdiff == 0
+    else:
+        # the lag must actually change the transfer between ranks
+        assert maxdiff > 0
+    teardown()
+
+
 if __name__ == "__main__":
     test_partrans()
+    test_partrans_lag()
     pc.barrier()
     h.quit()
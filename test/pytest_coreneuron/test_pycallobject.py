@@ -1,5 +1,7 @@
+import functools
 from neuron import h, gui
 from neuron.expect_hocerr import expect_err
+import numpy as np
 import sys
 
 pc = h.ParallelContext()
@@ -149,9 +151,35 @@ def test_call_picklef():
         print(e)
 
 
+def g(a, b):
+    return a.sum(), b * 2
+
+
+def test_call_picklef_arrays():
+    # arrays in the arguments and the result are pickle protocol 5 out of
+    # band buffers
+    pc.runworker()
+    a = np.arange(100000.0)
+    b = np.asfortranarray(np.ones((300, 200)))
+    pc.submit(g, a, b)
+    while pc.working():
+        s, b2 = pc.pyret()
+    assert s == a.sum()
+    assert b2.flags.f_contiguous and b2.flags.writeable
+    assert (b2 == 2 * b).all()
+
+    # and so are the arrays bound in a callable
+    pc.submit(functools.partial(g, a), b)
+    while pc.working():
+        s, b2 = pc.pyret()
+    assert s == a.sum()
+    assert (b2 == 2 * b).all()
+
+
 if __name__ == "__main__":
     test_praxis()
     test_finithandler()
     test_py2n_component()
     test_call_picklef()
+    test_call_picklef_arrays()
     test_func_call()
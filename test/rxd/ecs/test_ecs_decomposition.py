@@ -0,0 +1,55 @@
+import pytest
+
+from testutils import reset_rxd
+
+
+@pytest.mark.parametrize("cvode", [False, True])
+def test_ecs_decomposition(neuron_nosave_instance, cvode):
+    """A grid split between the MPI processes gives the same concentrations
+    on the planes each process owns, and at its segments, as the grid solved
+    in full. Each process places its cell in the planes of the next one, so
+    the membrane currents and the concentrations they read cross processes.
+    With a single process decompose has no effect."""
+
+    h, rxd, save_path = neuron_nosave_instance
+    pc = h.ParallelContext()
+    rank, nhost = int(pc.id()), int(pc.nhost())
+    n, dx = 12, 5
+    xlo = -n * dx / 2
+
+    def planes(r):
+        return r * n // nhost, (r + 1) * n // nhost
+
+    x0, x1 = planes((rank + 1) % nhost)
+    x = xlo + dx * (x0 + x1) / 2
+    soma = h.Section(name=f"soma{rank}")
+    soma.pt3dadd(x, -10, 0, 10)
+    soma.pt3dadd(x, 10, 0, 10)
+    soma.nseg = 3
+    soma.insert("hh")
+    stim = h.IClamp(soma(0.5))
+    stim.delay, stim.dur, stim.amp = 1, 5, 0.5
+
+    def run(decompose):
+        ecs = rxd.Extracellular(xlo, -15, -15, -xlo, 15, 15, dx=dx, decompose=decompose)
+        k = rxd.Species(ecs, name="k", d=2, charge=1, initial=3)
+        relax = rxd.Rate(k, 0.05 * (3 - k))
+        ko = [h.Vector().record(seg._ref_ko) for seg in soma]
+        h.cvode_active(cvode)
+        h.finitialize(-65)
+        h.continuerun(10)
+        h.cvode_active(False)
+        x0, x1 = planes(rank)
+        return k[ecs].states3d[x0:x1].copy(), [v.to_python() for v in ko]
+
+    states, traces = run(decompose=False)
+    reset_rxd(rxd)
+    result = run(decompose=True)
+
+    # the variable step error control also sees the voxels of other
+    # processes, which a decomposed grid leaves unchanged
+    tol = 1e-3 if cvode else 1e-10
+    assert abs(result[0] - states).max() <= tol * abs(states).max()
+    if not cvode:
+        for a, b in zip(result[1], traces):
+            assert max(abs(p - q) for p, q in zip(a, b)) <= tol * max(b)
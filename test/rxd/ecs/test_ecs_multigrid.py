@@ -0,0 +1,101 @@
+import pytest
+
+
+@pytest.fixture
+def ecs_pair(neuron_nosave_instance):
+    """The same diffusion problem on two regions, one solved by ADI and one by
+    multigrid."""
+
+    h, rxd, save_path = neuron_nosave_instance
+    h("create dummy")
+
+    def make_model(n, dx, bc=None):
+        species = []
+        for solver in ["adi", "multigrid"]:
+            ecs = rxd.Extracellular(
+                -n * dx / 2,
+                -n * dx / 2,
+                -n * dx / 2,
+                n * dx / 2,
+                n * dx / 2,
+                n * dx / 2,
+                dx=dx,
+                solver=solver,
+            )
+            k = rxd.Species(
+                ecs,
+                name=f"k_{solver}",
+                d=1,
+                charge=1,
+                initial=lambda nd: (
+                    1 if nd.x3d**2 + nd.y3d**2 + nd.z3d**2 < (2 * dx) ** 2 else 0
+                ),
+                ecs_boundary_conditions=bc,
+            )
+            species.append((ecs, k))
+        return species
+
+    yield (h, rxd, make_model)
+    h.cvode_active(False)
+    h.dt = 0.025
+
+
+def test_ecs_multigrid_matches_adi(ecs_pair):
+    """Both solvers converge to the same solution for small time steps and
+    zero flux boundaries conserve the total amount."""
+
+    h, rxd, make_model = ecs_pair
+    (ecs_a, k_a), (ecs_m, k_m) = make_model(15, 5)
+    h.finitialize(-65)
+    total = k_m[ecs_m].states3d.sum()
+    h.continuerun(20)
+    adi, mg = k_a[ecs_a].states3d, k_m[ecs_m].states3d
+    assert abs(adi - mg).max() < 1e-3
+    assert abs(mg.sum() - total) < 1e-9 * total
+
+
+def test_ecs_multigrid_large_dt(ecs_pair):
+    """The backward Euler step is stable and keeps the concentrations between
+    the boundary and the initial values for any time step."""
+
+    h, rxd, make_model = ecs_pair
+    (ecs_a, k_a), (ecs_m, k_m) = make_model(16, 5, bc=0)
+    h.dt = 50
+    h.finitialize(-65)
+    h.continuerun(500)
+    mg = k_m[ecs_m].states3d
+    assert mg.min() >= -1e-12 and mg.max() <= 1
+    # the interior has decayed towards the Dirichlet boundary
+    assert mg.max() < 0.1
+
+
+def test_ecs_multigrid_zero(neuron_nosave_instance):
+    """A zero right hand side gives exactly zero, where a relative tolerance
+    alone could never be met."""
+
+    h, rxd, save_path = neuron_nosave_instance
+    ecs = rxd.Extracellular(-40, -40, -40, 40, 40, 40, dx=5, solver="multigrid")
+    k = rxd.Species(ecs, name="k", d=1, charge=1, initial=0, ecs_boundary_conditions=0)
+    h.dt = 10
+    h.finitialize(-65)
+    h.continuerun(50)
+    assert not k[ecs].states3d.any()
+    h.dt = 0.025
+
+
+def test_ecs_multigrid_cvode(ecs_pair):
+    """Multigrid preconditions the variable step method."""
+
+    h, rxd, make_model = ecs_pair
+    (ecs_a, k_a), (ecs_m, k_m) = make_model(12, 5)
+    h.cvode_active(True)
+    h.finitialize(-65)
+    h.continuerun(20)
+    adi, mg = k_a[ecs_a].states3d, k_m[ecs_m].states3d
+    assert abs(adi - mg).max() < 1e-3
+
+
+def test_ecs_solver_invalid(neuron_nosave_instance):
+    h, rxd, save_path = neuron_nosave_instance
+    with pytest.raises(rxd.RxDException):
+        rxd.Extracellular(0, 0, 0, 10, 10, 10, dx=5, solver="fft")
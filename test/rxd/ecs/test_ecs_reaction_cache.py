@@ -0,0 +1,88 @@
+import os
+
+import pytest
+
+
+@pytest.fixture
+def ecs_cache(neuron_nosave_instance, tmp_path):
+    """Extracellular reactions compiled into an empty kernel cache."""
+
+    h, rxd, save_path = neuron_nosave_instance
+    cache_dir = rxd.options.reaction_cache_dir
+    rxd.options.reaction_cache_dir = str(tmp_path)
+    ecs = rxd.Extracellular(-20, -20, -20, 20, 20, 20, dx=4)
+    ca = rxd.Species(
+        ecs,
+        name="ca",
+        d=0.5,
+        charge=2,
+        initial=lambda nd: 1 if nd.x3d**2 + nd.y3d**2 + nd.z3d**2 < 50 else 0.1,
+    )
+    buf = rxd.Species(ecs, name="buf", d=0.1, initial=0.5)
+    cabuf = rxd.Species(ecs, name="cabuf", d=0.1, initial=0)
+    binding = rxd.Reaction(ca + buf, cabuf, 1, 0.1)
+    yield (h, rxd, ecs, ca, binding, tmp_path)
+    rxd.options.reaction_cache_dir = cache_dir
+
+
+def test_ecs_reaction_cache(ecs_cache):
+    """The batched reaction kernel is compiled once and reused from the cache."""
+
+    h, rxd, ecs, ca, binding, tmp_path = ecs_cache
+
+    def kernels():
+        return sorted(f for f in os.listdir(tmp_path) if f.endswith(".so"))
+
+    h.finitialize(-65)
+    h.continuerun(5)
+    cached = kernels()
+    assert len(cached) == 1
+    mtime = os.path.getmtime(tmp_path / cached[0])
+    result = ca[ecs].states3d.copy()
+
+    # the same reactions hash to the same kernel
+    h.finitialize(-65)
+    rxd.rxd._setup_units(force=True)
+    h.continuerun(5)
+    assert kernels() == cached
+    assert os.path.getmtime(tmp_path / cached[0]) == mtime
+    assert (ca[ecs].states3d == result).all()
+
+    # without the cache the kernel is compiled afresh, with the same results
+    rxd.options.reaction_cache_dir = None
+    h.finitialize(-65)
+    rxd.rxd._setup_units(force=True)
+    h.continuerun(5)
+    assert (ca[ecs].states3d == result).all()
+
+
+def test_ecs_reaction_batch(ecs_cache):
+    """The batched kernel gives the concentrations of one call per voxel."""
+
+    h, rxd, ecs, ca, binding, tmp_path = ecs_cache
+    h.finitialize(-65)
+    h.continuerun(5)
+    result = ca[ecs].states3d.copy()
+
+    rxd.options.ecs_reaction_batch = False
+    try:
+        h.finitialize(-65)
+        rxd.rxd._setup_units(force=True)
+        h.continuerun(5)
+    finally:
+        rxd.options.ecs_reaction_batch = True
+    assert abs(ca[ecs].states3d - result).max() <= 1e-12 * abs(result).max()
+
+
+def test_reaction_cache_dir(neuron_nosave_instance, monkeypatch, tmp_path):
+    """NRN_RXD_CACHE_DIR, set or empty, wins over XDG_CACHE_HOME."""
+
+    h, rxd, save_path = neuron_nosave_instance
+    options = rxd.options
+    monkeypatch.delenv("NRN_RXD_CACHE_DIR", raising=False)
+    monkeypatch.setenv("XDG_CACHE_HOME", str(tmp_path))
+    assert options._default_reaction_cache_dir() == str(tmp_path / "neuron" / "rxd")
+    monkeypatch.setenv("NRN_RXD_CACHE_DIR", str(tmp_path / "kernels"))
+    assert options._default_reaction_cache_dir() == str(tmp_path / "kernels")
+    monkeypatch.setenv("NRN_RXD_CACHE_DIR", "")
+    assert options._default_reaction_cache_dir() is None
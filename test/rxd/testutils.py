@@ -1,3 +1,5 @@
+import ctypes
+import gc
 import inspect
 import itertools
 import os
@@ -36,6 +38,41 @@ def save_data_from_test(save_path):
     return filepath
 
 
+def reset_rxd(rxd):
+    """removes all species, regions and reactions, leaving the sections"""
+
+    # With Python 3.11 on macOS there seemed to be problems related to garbage
+    # collection happening during the following teardown
+    gc.disable()
+    for r in rxd.rxd._all_reactions[:]:
+        if r():
+            rxd.rxd._unregister_reaction(r)
+
+    for s in rxd.species._all_species:
+        if s():
+            s().__del__()
+    gc.enable()
+    rxd.region._all_regions = []
+    rxd.rxd.node._states = numpy.array([])
+    rxd.rxd.node._volumes = numpy.array([])
+    rxd.rxd.node._surface_area = numpy.array([])
+    rxd.rxd.node._diffs = numpy.array([])
+    rxd.rxd.node._states = numpy.array([])
+    rxd.region._region_count = 0
+    rxd.region._c_region_lookup = None
+    rxd.species._species_counts = 0
+    rxd.section1d._purge_cptrs()
+    rxd.initializer.has_initialized = False
+    rxd.initializer.is_initializing = False
+    rxd.rxd.free_conc_ptrs()
+    rxd.rxd.free_curr_ptrs()
+    rxd.rxd.rxd_include_node_flux1D(0, None, None, None)
+    rxd.species._has_1d = False
+    rxd.species._has_3d = False
+    rxd.rxd._zero_volume_indices = numpy.ndarray(0, dtype=ctypes.c_long)
+    rxd.set_solve_type(dimension=1)
+
+
 def collect_data(h, rxd, data, save_path, num_record=10):
     """grabs the membrane potential data, h.t, and the rxd state values"""
     data["record_count"] += 1
@@ -1,7 +1,11 @@
 #include "neuron/container/soa_container.hpp"
 #include "neuron/container/view_utils.hpp"
+#include "neuron/cache/model_data.hpp"
 #include "neuron/model_data.hpp"
+#include "membfunc.h"
+#include "multicore.h"
 #include "nrn_ansi.h"
+#include "nrniv_mf.h"
 
 #include <catch2/catch_test_macros.hpp>
 
@@ -118,6 +122,39 @@ TEST_CASE("Multi-threaded calls to nrn_ensure_model_data_are_sorted()",
     }
 }
 
+TEST_CASE("cache::Mechanism pdata offsets", "[Neuron][data_structures]") {
+    GIVEN("Two sections with hh, which uses the na and k ions") {
+        REQUIRE(hoc_oc("create s1, s2\n"
+                       "forall { nseg = 3 insert hh }\n"
+                       "s2 nseg = 5\n"
+                       "finitialize(-65)\n") == 0);
+        auto const type = nrn_get_mechtype("hh");
+        auto* const ml = nrn_threads[0]._ml_list[type];
+        REQUIRE(ml);
+        REQUIRE(ml->nodecount == 8);
+        THEN("Column start plus offset gives the pointer held by the Datum") {
+            auto const token = nrn_ensure_model_data_are_sorted();
+            auto const& mech_cache = token.mech_cache(type);
+            std::size_t ncached{};
+            for (std::size_t field = 0; field < mech_cache.pdata_base.size(); ++field) {
+                auto* const base = mech_cache.pdata_base[field];
+                if (!base) {
+                    REQUIRE_FALSE(mech_cache.pdata_index_ptr[field]);
+                    continue;
+                }
+                ++ncached;
+                auto const* const index = mech_cache.pdata_index_ptr[field];
+                for (int i = 0; i < ml->nodecount; ++i) {
+                    REQUIRE(base + index[ml->get_storage_offset() + i] == ml->dptr_field(i, field));
+                }
+            }
+            REQUIRE(ncached > 0);
+            REQUIRE(mech_cache.pdata_index.size() == ncached * ml->nodecount);
+        }
+        REQUIRE(hoc_oc("forall delete_section()") == 0);
+    }
+}
+
 TEST_CASE("soa::get_array_dims", "[Neuron][data_structures]") {
     storage data;
 
@@ -163,6 +200,27 @@ TEST_CASE("defer delete storage pointer", "[Neuron][internal][data_structures]")
     CHECK(usage_after.size <= usage_after.capacity);
 }
 
+TEST_CASE("pinned storage outlives reallocation", "[Neuron][internal][data_structures]") {
+    storage data;
+    std::vector<owning_handle> rows{};
+    for (int i = 0; i < 3; ++i) {
+        rows.emplace_back(data);
+        data.get<field::B>(i) = i;
+    }
+    data.pin_storage();
+    double const* const view = data.get_data_ptrs<field::B>()[0];
+    // growing the container and deleting rows leave the pinned column alone
+    for (int i = 0; i < 100; ++i) {
+        rows.emplace_back(data);
+    }
+    rows.erase(rows.begin());
+    CHECK(data.get_data_ptrs<field::B>()[0] != view);
+    CHECK(view[0] == 0.);
+    CHECK(view[1] == 1.);
+    CHECK(view[2] == 2.);
+    data.unpin_storage();
+}
+
 template <class Tag, class Storage>
 std::size_t compute_row_size(const Storage& data) {
     std::size_t local_size = 0ul;
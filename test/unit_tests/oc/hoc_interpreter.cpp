@@ -7,8 +7,12 @@
 #include "hocdec.h"
 #include "classreg.h"
 #include "ocfunc.h"
+#include "oc_ansi.h"
+#include "parse.hpp"
 
 #include <sstream>
+#include <string>
+#include <vector>
 
 TEST_CASE("Test hoc interpreter", "[NEURON][hoc_interpreter]") {
     hoc_init_space();
@@ -189,6 +193,40 @@ SCENARIO("Test calling code from HOC that throws exceptions", "[NEURON][hoc_inte
     }
 }
 
+TEST_CASE("Test symbol table lookup", "[NEURON][hoc_interpreter][symlist]") {
+    Symlist* sl = nullptr;
+    std::vector<Symbol*> syms;
+    for (int i = 0; i < 100; ++i) {
+        syms.push_back(hoc_install(("s" + std::to_string(i)).c_str(), UNDEF, 0., &sl));
+    }
+    Symbol* dup = hoc_install("s50", UNDEF, 0., &sl);
+    // the first lookups scan the list, later ones use the index
+    for (int pass = 0; pass < 2; ++pass) {
+        for (int i = 0; i < 100; ++i) {
+            REQUIRE(hoc_table_lookup(("s" + std::to_string(i)).c_str(), sl) == syms[i]);
+        }
+        REQUIRE(hoc_table_lookup("s100", sl) == nullptr);
+    }
+    WHEN("Symbols are added, removed and renamed") {
+        Symbol* late = hoc_install("late", UNDEF, 0., &sl);
+        REQUIRE(hoc_table_lookup("late", sl) == late);
+        // the first symbol of a name is found
+        hoc_unlink_symbol(syms[50], sl);
+        REQUIRE(hoc_table_lookup("s50", sl) == dup);
+        hoc_link_symbol(syms[50], sl);
+        REQUIRE(hoc_table_lookup("s50", sl) == dup);
+        hoc_unlink_symbol(syms[3], sl);
+        REQUIRE(hoc_table_lookup("s3", sl) == nullptr);
+        hoc_link_symbol(syms[3], sl);
+        REQUIRE(hoc_table_lookup("s3", sl) == syms[3]);
+        hoc_symbol_rename(syms[7], "renamed");
+        REQUIRE(hoc_table_lookup("renamed", sl) == syms[7]);
+        REQUIRE(hoc_table_lookup("s7", sl) == nullptr);
+    }
+    hoc_free_list(&sl);
+    REQUIRE(sl == nullptr);
+}
+
 #if USE_PYTHON
 TEST_CASE("Test hoc_array_access", "[NEURON][hoc_interpreter][nrnpython][array_access]") {
     REQUIRE(hoc_oc("nrnpython(\"avec = [0,1,2]\")\n"